@@ -53,6 +53,9 @@ std::pair<bool, ASTBinaryOperator::BuiltIn> ASTBinaryOperator::builtInPrimitiveO
                                                                                         const Type &type) {
     if ((type.type() == TypeType::ValueType || type.type() == TypeType::Enum) &&
         type.valueType()->isPrimitive()) {
+        if (analyser->compiler()->isVectorType(type.valueType())) {
+            return builtInVectorOperator(analyser, type);
+        }
         if (type.valueType() == analyser->compiler()->sReal) {
             switch (operator_) {
                 case OperatorType::MultiplicationOperator:
@@ -170,6 +173,69 @@ std::pair<bool, ASTBinaryOperator::BuiltIn> ASTBinaryOperator::builtInPrimitiveO
     return std::make_pair(false, BuiltIn(Type::noReturn()));
 }
 
+std::pair<bool, ASTBinaryOperator::BuiltIn> ASTBinaryOperator::builtInVectorOperator(ExpressionAnalyser *analyser,
+                                                                                     const Type &type) {
+    auto vectorType = type.unboxed();
+    vectorType.setReference(false);
+    auto lanesAreIntegers = type.valueType() != analyser->compiler()->sRealVector;
+    switch (operator_) {
+        case OperatorType::PlusOperator:
+            builtIn_ = BuiltInType::VectorAdd;
+            return std::make_pair(true, BuiltIn(vectorType));
+        case OperatorType::MinusOperator:
+            builtIn_ = BuiltInType::VectorSubstract;
+            return std::make_pair(true, BuiltIn(vectorType));
+        case OperatorType::MultiplicationOperator:
+            builtIn_ = BuiltInType::VectorMultiply;
+            return std::make_pair(true, BuiltIn(vectorType));
+        case OperatorType::DivisionOperator:
+            builtIn_ = BuiltInType::VectorDivide;
+            return std::make_pair(true, BuiltIn(vectorType));
+        case OperatorType::RemainderOperator:
+            builtIn_ = BuiltInType::VectorRemainder;
+            return std::make_pair(true, BuiltIn(vectorType));
+        case OperatorType::EqualOperator:
+            builtIn_ = BuiltInType::VectorEqual;
+            return std::make_pair(true, BuiltIn(analyser->integer()));
+        case OperatorType::LessOperator:
+            builtIn_ = BuiltInType::VectorLess;
+            return std::make_pair(true, BuiltIn(analyser->integer()));
+        case OperatorType::LessOrEqualOperator:
+            builtIn_ = BuiltInType::VectorLessOrEqual;
+            return std::make_pair(true, BuiltIn(analyser->integer()));
+        case OperatorType::GreaterOperator:
+            builtIn_ = BuiltInType::VectorGreater;
+            return std::make_pair(true, BuiltIn(analyser->integer()));
+        case OperatorType::GreaterOrEqualOperator:
+            builtIn_ = BuiltInType::VectorGreaterOrEqual;
+            return std::make_pair(true, BuiltIn(analyser->integer()));
+        default:
+            break;
+    }
+    if (lanesAreIntegers) {
+        switch (operator_) {
+            case OperatorType::BitwiseAndOperator:
+                builtIn_ = BuiltInType::VectorAnd;
+                return std::make_pair(true, BuiltIn(vectorType));
+            case OperatorType::BitwiseOrOperator:
+                builtIn_ = BuiltInType::VectorOr;
+                return std::make_pair(true, BuiltIn(vectorType));
+            case OperatorType::BitwiseXorOperator:
+                builtIn_ = BuiltInType::VectorXor;
+                return std::make_pair(true, BuiltIn(vectorType));
+            case OperatorType::ShiftLeftOperator:
+                builtIn_ = BuiltInType::VectorLeftShift;
+                return std::make_pair(true, BuiltIn(vectorType));
+            case OperatorType::ShiftRightOperator:
+                builtIn_ = BuiltInType::VectorRightShift;
+                return std::make_pair(true, BuiltIn(vectorType));
+            default:
+                break;
+        }
+    }
+    return std::make_pair(false, BuiltIn(Type::noReturn()));
+}
+
 void ASTBinaryOperator::analyseMemoryFlow(MFFunctionAnalyser *analyser, MFFlowCategory type) {
     if (builtIn_ != BuiltInType::None) {
         left_->analyseMemoryFlow(analyser, MFFlowCategory::Borrowing);
@@ -37,6 +37,10 @@ private:
     };
 
     std::pair<bool, BuiltIn> builtInPrimitiveOperator(ExpressionAnalyser *analyser, const Type &type);
+    /// Determines the built-in for an operator applied to one of the SIMD vector types.
+    std::pair<bool, BuiltIn> builtInVectorOperator(ExpressionAnalyser *analyser, const Type &type);
+    /// Converts the operands into LLVM vectors, applies the operation lane-wise and converts the result back.
+    Value* generateVectorOperation(FunctionCodeGenerator *fg, Value *left, Value *right) const;
     void printBinaryOperand(int precedence, const std::shared_ptr<ASTExpr> &expr, PrettyStream &pretty) const;
     Type analyseIsNoValue(ExpressionAnalyser *analyser, std::shared_ptr<ASTExpr> &expr,
                               BuiltInType builtInType);
@@ -71,6 +71,22 @@ Value* ASTBinaryOperator::generate(FunctionCodeGenerator *fg) const {
                 return fg->builder().CreateAnd(left, right);
             case BuiltInType::Equal:
                 return fg->builder().CreateICmpEQ(left, right);
+            case BuiltInType::VectorAdd:
+            case BuiltInType::VectorSubstract:
+            case BuiltInType::VectorMultiply:
+            case BuiltInType::VectorDivide:
+            case BuiltInType::VectorRemainder:
+            case BuiltInType::VectorAnd:
+            case BuiltInType::VectorOr:
+            case BuiltInType::VectorXor:
+            case BuiltInType::VectorLeftShift:
+            case BuiltInType::VectorRightShift:
+            case BuiltInType::VectorEqual:
+            case BuiltInType::VectorLess:
+            case BuiltInType::VectorLessOrEqual:
+            case BuiltInType::VectorGreater:
+            case BuiltInType::VectorGreaterOrEqual:
+                return generateVectorOperation(fg, left, right);
             case BuiltInType::IsNoValueLeft:
                 return left_->expressionType().storageType() == StorageType::Box
                         ? fg->buildHasNoValueBox(left)
@@ -88,4 +104,45 @@ Value* ASTBinaryOperator::generate(FunctionCodeGenerator *fg) const {
                                                                       args_, method_));
 }
 
+Value* ASTBinaryOperator::generateVectorOperation(FunctionCodeGenerator *fg, Value *left, Value *right) const {
+    auto l = fg->buildVectorFromLanes(left);
+    auto r = fg->buildVectorFromLanes(right);
+    auto real = llvm::cast<llvm::VectorType>(l->getType())->getElementType()->isFloatingPointTy();
+    auto &builder = fg->builder();
+    switch (builtIn_) {
+        case BuiltInType::VectorAdd:
+            return fg->buildLanesFromVector(real ? builder.CreateFAdd(l, r) : builder.CreateAdd(l, r));
+        case BuiltInType::VectorSubstract:
+            return fg->buildLanesFromVector(real ? builder.CreateFSub(l, r) : builder.CreateSub(l, r));
+        case BuiltInType::VectorMultiply:
+            return fg->buildLanesFromVector(real ? builder.CreateFMul(l, r) : builder.CreateMul(l, r));
+        case BuiltInType::VectorDivide:
+            return fg->buildLanesFromVector(real ? builder.CreateFDiv(l, r) : builder.CreateSDiv(l, r));
+        case BuiltInType::VectorRemainder:
+            return fg->buildLanesFromVector(real ? builder.CreateFRem(l, r) : builder.CreateSRem(l, r));
+        case BuiltInType::VectorAnd:
+            return fg->buildLanesFromVector(builder.CreateAnd(l, r));
+        case BuiltInType::VectorOr:
+            return fg->buildLanesFromVector(builder.CreateOr(l, r));
+        case BuiltInType::VectorXor:
+            return fg->buildLanesFromVector(builder.CreateXor(l, r));
+        case BuiltInType::VectorLeftShift:
+            return fg->buildLanesFromVector(builder.CreateShl(l, r));
+        case BuiltInType::VectorRightShift:
+            return fg->buildLanesFromVector(builder.CreateLShr(l, r));
+        case BuiltInType::VectorEqual:
+            return fg->buildMaskFromVector(real ? builder.CreateFCmpUEQ(l, r) : builder.CreateICmpEQ(l, r));
+        case BuiltInType::VectorLess:
+            return fg->buildMaskFromVector(real ? builder.CreateFCmpULT(l, r) : builder.CreateICmpSLT(l, r));
+        case BuiltInType::VectorLessOrEqual:
+            return fg->buildMaskFromVector(real ? builder.CreateFCmpULE(l, r) : builder.CreateICmpSLE(l, r));
+        case BuiltInType::VectorGreater:
+            return fg->buildMaskFromVector(real ? builder.CreateFCmpUGT(l, r) : builder.CreateICmpSGT(l, r));
+        case BuiltInType::VectorGreaterOrEqual:
+            return fg->buildMaskFromVector(real ? builder.CreateFCmpUGE(l, r) : builder.CreateICmpSGE(l, r));
+        default:
+            throw std::logic_error("Not a vector operation");
+    }
+}
+
 }  // namespace EmojicodeCompiler
@@ -120,6 +120,9 @@ class ASTSimpleErrorToBox final : public ASTToBox {
 class ASTSimpleToBox final : public ASTToBox {
     using ASTToBox::ASTToBox;
     Value* generate(FunctionCodeGenerator *fg) const override;
+    /// Produces a constant box if the boxed value is a constant that fits into the box. Boxes for protocols are
+    /// never constant.
+    llvm::Constant* generateConstant(FunctionCodeGenerator *fg) const override;
     void toCode(PrettyStream &pretty) const override {}
 };
 
@@ -11,6 +11,7 @@
 #include "Generation/FunctionCodeGenerator.hpp"
 #include "Generation/ProtocolsTableGenerator.hpp"
 #include "Types/TypeDefinition.hpp"
+#include <llvm/IR/Constants.h>
 
 namespace EmojicodeCompiler {
 
@@ -117,6 +118,26 @@ Value* ASTSimpleToBox::generate(FunctionCodeGenerator *fg) const {
     return fg->builder().CreateLoad(box);
 }
 
+llvm::Constant* ASTSimpleToBox::generateConstant(FunctionCodeGenerator *fg) const {
+    auto boxedFor = expressionType().boxedFor();
+    auto containedType = expr_->expressionType().unboxed().unoptionalized();
+    if (boxedFor.type() == TypeType::Protocol || boxedFor.type() == TypeType::MultiProtocol ||
+        fg->typeHelper().isRemote(containedType)) {
+        return nullptr;
+    }
+    auto value = expr_->generateConstant(fg);
+    if (value == nullptr) {
+        return nullptr;
+    }
+    auto boxInfo = llvm::ConstantExpr::getBitCast(fg->generator()->boxInfoFor(expr_->expressionType().unoptionalized()),
+                                                  fg->typeHelper().boxInfo()->getPointerTo());
+    auto valueAreaSize = fg->generator()->querySize(fg->typeHelper().box()) -
+        fg->generator()->querySize(boxInfo->getType());
+    auto padding = llvm::ArrayType::get(llvm::Type::getInt8Ty(fg->generator()->context()),
+                                        valueAreaSize - fg->generator()->querySize(value->getType()));
+    return llvm::ConstantStruct::getAnon({ boxInfo, value, llvm::ConstantAggregateZero::get(padding) });
+}
+
 Value* ASTSimpleOptionalToBox::generate(FunctionCodeGenerator *fg) const {
     auto value = expr_->generate(fg);
     auto box = fg->createEntryAlloca(fg->typeHelper().box());
@@ -8,16 +8,22 @@
 
 #include "ASTControlFlow.hpp"
 #include "AST/ASTNode.hpp"
+#include "ASTBinaryOperator.hpp"
+#include "ASTInitialization.hpp"
+#include "ASTLiterals.hpp"
 #include "ASTMethod.hpp"
 #include "ASTVariables.hpp"
 #include "Analysis/FunctionAnalyser.hpp"
 #include "Compiler.hpp"
 #include "Emojis.h"
+#include "Functions/Function.hpp"
 #include "MemoryFlowAnalysis/MFFunctionAnalyser.hpp"
+#include "Parsing/OperatorHelper.hpp"
 #include "Scoping/SemanticScoper.hpp"
 #include "Types/Class.hpp"
 #include "Types/Protocol.hpp"
 #include "Types/TypeExpectation.hpp"
+#include "Types/ValueType.hpp"
 
 namespace EmojicodeCompiler {
 
@@ -116,13 +122,119 @@ void ASTErrorHandler::analyseMemoryFlow(MFFunctionAnalyser *analyser) {
 void ASTForIn::analyse(FunctionAnalyser *analyser) {
     analyser->scoper().pushScope();
 
+    auto iterateeVar = U"iteratee" + varName_;
+    iterateeVariable_ = std::make_unique<ASTConstantVariable>(iterateeVar, iteratee_, position());
+    iterateeVariable_->analyse(analyser);
+    auto type = analyser->scoper().getVariable(iterateeVar, position()).variable.type();
+
     ASTBlock newBlock(position());
+    bool inBounds = false;
+    if (type.type() == TypeType::Class && type.klass() == analyser->compiler()->sString) {
+        auto graphemesVar = U"graphemes" + varName_;
+        auto graphemes = std::make_shared<ASTMethod>(std::u32string(1, 0x1F3B6),
+                                                     std::make_shared<ASTGetVariable>(iterateeVar, position()),
+                                                     ASTArguments(position()), position());
+        newBlock.appendNode(std::make_unique<ASTConstantVariable>(graphemesVar, graphemes, position()));
+        desugarIndexLoop(&newBlock, graphemesVar);
+    }
+    else if (isIterableByIndex(analyser, type)) {
+        VariableID collection;
+        auto element = desugarIndexLoop(&newBlock, iterateeVar);
+        if (iteratesIndices(analyser, &collection)) {
+            analyser->pushInBoundsIndex(element, collection);
+            inBounds = true;
+        }
+    }
+    else {
+        desugarIteratorLoop(&newBlock, iterateeVar);
+    }
+
+    block_ = std::move(newBlock);
+    block_.analyse(analyser);
+    block_.popScope(analyser);
+    if (inBounds) {
+        analyser->popInBoundsIndex();
+    }
+}
+
+bool ASTForIn::iteratesIndices(FunctionAnalyser *analyser, VariableID *collection) const {
+    auto init = std::dynamic_pointer_cast<ASTInitialization>(iteratee_);
+    if (init == nullptr || init->initializer() == nullptr || init->initializer()->name() != U"⏩" ||
+        init->initializer()->owner() != analyser->compiler()->sRange) {
+        return false;
+    }
+    // ⏩ counts downwards if stop is less than start. As 🐔 is never negative, a start of 0 ensures that all
+    // elements are in [0, 🐔collection❗️).
+    auto start = std::dynamic_pointer_cast<ASTNumberLiteral>(init->args().args()[0]);
+    auto count = std::dynamic_pointer_cast<ASTMethod>(init->args().args()[1]);
+    if (start == nullptr || !start->isIntegerZero() || count == nullptr || count->name() != U"🐔") {
+        return false;
+    }
+    auto countCallee = std::dynamic_pointer_cast<ASTGetVariable>(count->callee());
+    if (countCallee == nullptr || countCallee->inInstanceScope()) {
+        return false;
+    }
+    auto var = analyser->scoper().getVariable(countCallee->name(), position());
+    if (var.inInstanceScope || var.variable.id() != countCallee->id() || !var.variable.constant()) {
+        return false;
+    }
+    auto type = var.variable.type();
+    auto compiler = analyser->compiler();
+    if ((type.type() == TypeType::ValueType && type.valueType() == compiler->sList) ||
+        (type.type() == TypeType::Class && type.klass() == compiler->sData)) {
+        *collection = countCallee->id();
+        return true;
+    }
+    return false;
+}
 
+bool ASTForIn::isIterableByIndex(FunctionAnalyser *analyser, const Type &type) const {
+    auto compiler = analyser->compiler();
+    switch (type.type()) {
+        case TypeType::ValueType:
+            return type.valueType() == compiler->sList || type.valueType() == compiler->sRange;
+        case TypeType::Class:
+            return type.klass() == compiler->sData;
+        default:
+            return false;
+    }
+}
+
+const AccessesAnyVariable* ASTForIn::desugarIndexLoop(ASTBlock *block, const std::u32string &collectionVar) {
+    auto indexVar = U"index" + varName_;
+    block->appendNode(std::make_unique<ASTVariableDeclareAndAssign>(indexVar, std::make_shared<ASTNumberLiteral>(
+            static_cast<int64_t>(0), U"", position()), position()));
+
+    auto increment = std::make_shared<ASTNumberLiteral>(static_cast<int64_t>(1), U"", position());
+    block_.prependNode(std::make_unique<ASTOperatorAssignment>(indexVar, increment, position(),
+                                                               OperatorType::PlusOperator));
+    auto get = std::make_shared<ASTMethod>(std::u32string(1, 0x1F43D),
+                                           std::make_shared<ASTGetVariable>(collectionVar, position()),
+                                           ASTArguments(position(), {
+                                               std::make_shared<ASTGetVariable>(indexVar, position())
+                                           }), position());
+    get->setIndexInBounds();
+    auto element = std::make_unique<ASTConstantVariable>(varName_, get, position());
+    auto elementPtr = element.get();
+    block_.prependNode(std::move(element));
+
+    auto count = std::make_shared<ASTMethod>(std::u32string(1, 0x1F414),
+                                             std::make_shared<ASTGetVariable>(collectionVar, position()),
+                                             ASTArguments(position()), position());
+    auto hasNext = std::make_shared<ASTBinaryOperator>(OperatorType::LessOperator,
+                                                       std::make_shared<ASTGetVariable>(indexVar, position()),
+                                                       count, position());
+    block->appendNode(std::make_unique<ASTRepeatWhile>(hasNext, std::move(block_), position()));
+    return elementPtr;
+}
+
+void ASTForIn::desugarIteratorLoop(ASTBlock *block, const std::u32string &iterateeVar) {
     auto iteratorVar = U"iterator" + varName_;
 
-    auto getIterator = std::make_shared<ASTMethod>(std::u32string(1, E_DANGO), std::move(iteratee_),
+    auto getIterator = std::make_shared<ASTMethod>(std::u32string(1, E_DANGO),
+                                                   std::make_shared<ASTGetVariable>(iterateeVar, position()),
                                                    ASTArguments(position()), position());
-    newBlock.appendNode(std::make_unique<ASTConstantVariable>(iteratorVar, getIterator, position()));
+    block->appendNode(std::make_unique<ASTConstantVariable>(iteratorVar, getIterator, position()));
     auto getNext = std::make_shared<ASTMethod>(std::u32string(1, 0x1F53D),
                                                std::make_shared<ASTGetVariable>(iteratorVar, position()),
                                                ASTArguments(position()), position());
@@ -131,13 +243,11 @@ void ASTForIn::analyse(FunctionAnalyser *analyser) {
     auto hasNext = std::make_shared<ASTMethod>(std::u32string(1, 0x1F53D),
                                                std::make_shared<ASTGetVariable>(iteratorVar, position()),
                                                ASTArguments(position(), Mood::Interogative), position());
-    newBlock.appendNode(std::make_unique<ASTRepeatWhile>(hasNext, std::move(block_), position()));
-    block_ = std::move(newBlock);
-    block_.analyse(analyser);
-    block_.popScope(analyser);
+    block->appendNode(std::make_unique<ASTRepeatWhile>(hasNext, std::move(block_), position()));
 }
 
 void ASTForIn::analyseMemoryFlow(MFFunctionAnalyser *analyser) {
+    iterateeVariable_->analyseMemoryFlow(analyser);
     block_.analyseMemoryFlow(analyser);
     analyser->popScope(&block_);
 }
@@ -49,6 +49,8 @@ protected:
     ASTBlock block_;
 };
 
+class AccessesAnyVariable;
+
 class ASTForIn final : public ASTStatement {
 public:
     ASTForIn(std::shared_ptr<ASTExpr> iteratee, std::u32string varName, ASTBlock block,
@@ -65,6 +67,22 @@ private:
     std::shared_ptr<ASTExpr> iteratee_;
     ASTBlock block_;
     std::u32string varName_;
+    /// The statement storing the iteratee into a variable. It is analysed before the loop is desugared so that the
+    /// type of the iteratee is known.
+    std::unique_ptr<ASTStatement> iterateeVariable_;
+
+    /// Returns true if the iteratee is of a type of the s package that can be iterated by index without an
+    /// iterator object.
+    bool isIterableByIndex(FunctionAnalyser *analyser, const Type &type) const;
+    /// Appends a counted loop, which uses 🐔 and 🐽 of the collection in the variable `collectionVar`, to `block`.
+    /// @returns The node declaring the variable that holds the current element.
+    const AccessesAnyVariable* desugarIndexLoop(ASTBlock *block, const std::u32string &collectionVar);
+    /// Determines whether the iteratee is a range `🆕⏩⏩ 0 🐔collection❗️❗️` whose elements are valid indices of a
+    /// 🍨 or 📇 in a constant local variable.
+    /// @param collection Set to the ID of the collection variable if true is returned.
+    bool iteratesIndices(FunctionAnalyser *analyser, VariableID *collection) const;
+    /// Appends a loop, which obtains an iterator using 🍡 and calls 🔽 on it, to `block`.
+    void desugarIteratorLoop(ASTBlock *block, const std::u32string &iterateeVar);
 };
 
 class ASTErrorHandler final : public ASTStatement {
@@ -111,6 +111,8 @@ void ASTErrorHandler::generate(FunctionCodeGenerator *fg) const {
 }
 
 void ASTForIn::generate(FunctionCodeGenerator *fg) const {
+    iterateeVariable_->generate(fg);
+    fg->releaseTemporaryObjects();
     block_.generate(fg);
 }
 
@@ -33,6 +33,11 @@ Type ASTSizeOf::analyse(ExpressionAnalyser *analyser, const TypeExpectation &exp
     return analyser->integer();
 }
 
+Type ASTIsTriviallyCopyable::analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) {
+    type_->analyseType(analyser->typeContext());
+    return analyser->boolean();
+}
+
 Type ASTConditionalAssignment::analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) {
     Type t = analyser->expect(TypeExpectation(false, false), &expr_);
     if (t.unboxedType() != TypeType::Optional) {
@@ -19,6 +19,10 @@
 #include <llvm/IR/Value.h>
 #include <utility>
 
+namespace llvm {
+class Constant;
+}  // namespace llvm
+
 namespace EmojicodeCompiler {
 
 using llvm::Value;
@@ -44,6 +48,12 @@ public:
     virtual Type analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) = 0;
     virtual void analyseMemoryFlow(MFFunctionAnalyser *analyser, MFFlowCategory type) = 0;
 
+    /// Subclasses can override this method if the value of the expression can be determined at compile time.
+    /// The returned constant must not require any management, i.e. it must neither be retained nor released.
+    /// ASTExpr’s implementation returns `nullptr`.
+    /// @returns A constant representing the value of the expression or `nullptr`.
+    virtual llvm::Constant* generateConstant(FunctionCodeGenerator *fg) const { return nullptr; }
+
     /// Informs this expression that if it creates a temporary object the object must not be released after the
     /// statement is executed. This method is called by MFFunctionAnalyser.
     void unsetIsTemporary() { isTemporary_ = false; unsetIsTemporaryPost(); }
@@ -139,6 +149,22 @@ private:
     std::unique_ptr<ASTType> type_;
 };
 
+/// Evaluates to true if values of the type can be copied bit by bit, i.e. if copying them does not require any
+/// retains. Generic variables of copy-reified functions are resolved, so the result is constant per reification.
+class ASTIsTriviallyCopyable final : public ASTExpr {
+public:
+    ASTIsTriviallyCopyable(std::unique_ptr<ASTType> type, const SourcePosition &p)
+        : ASTExpr(p), type_(std::move(type)) {}
+    Type analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) override;
+    Value* generate(FunctionCodeGenerator *fg) const override;
+
+    void toCode(PrettyStream &pretty) const override;
+    void analyseMemoryFlow(MFFunctionAnalyser *analyser, MFFlowCategory type) override {}
+
+private:
+    std::unique_ptr<ASTType> type_;
+};
+
 class ASTArguments final : public ASTNode {
 public:
     explicit ASTArguments(const SourcePosition &p) : ASTNode(p) {}
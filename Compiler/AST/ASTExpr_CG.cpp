@@ -48,6 +48,11 @@ Value* ASTSizeOf::generate(FunctionCodeGenerator *fg) const {
     return fg->sizeOf(fg->typeHelper().llvmTypeFor(type_->type()));
 }
 
+Value* ASTIsTriviallyCopyable::generate(FunctionCodeGenerator *fg) const {
+    auto trivial = fg->typeHelper().isTriviallyCopyable(type_->type());
+    return llvm::ConstantInt::get(llvm::Type::getInt1Ty(fg->generator()->context()), trivial);
+}
+
 Value* ASTConditionalAssignment::generate(FunctionCodeGenerator *fg) const {
     auto optional = expr_->generate(fg);
 
@@ -25,7 +25,15 @@ Type ASTInitialization::analyse(ExpressionAnalyser *analyser, const TypeExpectat
     }
 
     if (type.type() == TypeType::ValueType) {
-        initType_ = type.valueType() == analyser->compiler()->sMemory ? InitType::MemoryAllocation : InitType::ValueType;
+        if (type.valueType() == analyser->compiler()->sMemory) {
+            initType_ = InitType::MemoryAllocation;
+        }
+        else if (analyser->compiler()->isVectorType(type.valueType())) {
+            initType_ = InitType::VectorBroadcast;
+        }
+        else {
+            initType_ = InitType::ValueType;
+        }
 
         type.setMutable(expectation.isMutable());
     }
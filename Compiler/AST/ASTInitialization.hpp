@@ -20,7 +20,7 @@ enum class CallType;
 class ASTInitialization final : public ASTExpr, public MFHeapAllocates {
 public:
     enum class InitType {
-        Enum, ValueType, Class, ClassStack, MemoryAllocation
+        Enum, ValueType, Class, ClassStack, MemoryAllocation, VectorBroadcast
     };
 
     ASTInitialization(std::u32string name, std::shared_ptr<ASTExpr> type,
@@ -41,6 +41,9 @@ public:
     void setDestination(llvm::Value *dest) { vtDestination_ = dest; }
     /// Returns the type of type which is initialized.
     InitType initType() { return initType_; }
+    /// Returns the initializer that is called. Only available after semantic analysis.
+    Function* initializer() const { return initializer_; }
+    const ASTArguments& args() const { return args_; }
 
     void allocateOnStack() override;
 
@@ -57,6 +60,8 @@ private:
 
     Value* generateClassInit(FunctionCodeGenerator *fg) const;
     Value* generateMemoryAllocation(FunctionCodeGenerator *fg) const;
+    /// Generates a SIMD vector with the argument in all lanes.
+    Value* generateVectorBroadcast(FunctionCodeGenerator *fg) const;
     Value* generateInitValueType(FunctionCodeGenerator *fg) const;
 
     Type analyseEnumInit(ExpressionAnalyser *analyser, Type &type);
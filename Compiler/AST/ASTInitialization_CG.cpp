@@ -29,6 +29,8 @@ Value* ASTInitialization::generate(FunctionCodeGenerator *fg) const {
             return generateInitValueType(fg);
         case InitType::MemoryAllocation:
             return generateMemoryAllocation(fg);
+        case InitType::VectorBroadcast:
+            return generateVectorBroadcast(fg);
     }
 }
 
@@ -76,4 +78,10 @@ Value* ASTInitialization::generateMemoryAllocation(FunctionCodeGenerator *fg) co
     return fg->builder().CreateCall(fg->generator()->declarator().alloc(), size, "alloc");
 }
 
+Value* ASTInitialization::generateVectorBroadcast(FunctionCodeGenerator *fg) const {
+    auto lanesType = llvm::cast<llvm::ArrayType>(fg->typeHelper().llvmTypeFor(typeExpr_->expressionType()));
+    auto value = fg->builder().CreateTrunc(args_.args()[0]->generate(fg), lanesType->getElementType());
+    return fg->buildLanesFromVector(fg->builder().CreateVectorSplat(lanesType->getNumElements(), value));
+}
+
 }  // namespace EmojicodeCompiler
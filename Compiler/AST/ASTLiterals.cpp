@@ -17,6 +17,7 @@
 #include "Types/ValueType.hpp"
 #include "Types/CommonTypeFinder.hpp"
 #include "Types/TypeExpectation.hpp"
+#include "Utils/StringUtils.hpp"
 
 namespace EmojicodeCompiler {
 
@@ -149,9 +150,18 @@ Type ASTConcatenateLiteral::analyse(ExpressionAnalyser *analyser, const TypeExpe
     type_ = analyser->package()->getRawType(TypeIdentifier(U"🔠", kDefaultNamespace, position()));
 
     auto stringType = Type(analyser->compiler()->sString);
+    int64_t capacity = 0;
     for (auto &stringNode : values_) {
         analyser->expectType(stringType, &stringNode);
+        if (auto literal = std::dynamic_pointer_cast<ASTStringLiteral>(stringNode)) {
+            capacity += utf8(literal->value()).size();
+        }
+        else {
+            capacity += kEstimatedValueLength;
+        }
     }
+    capacity_ = std::make_shared<ASTNumberLiteral>(capacity, std::u32string(), position());
+    analyser->expectType(analyser->integer(), &capacity_);
     type_.setExact(true);
     return stringType;
 }
@@ -21,10 +21,13 @@ public:
     ASTStringLiteral(std::u32string value, const SourcePosition &p) : ASTExpr(p), value_(std::move(value)) {}
     Type analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) override;
     Value* generate(FunctionCodeGenerator *fg) const override;
+    llvm::Constant* generateConstant(FunctionCodeGenerator *fg) const override;
 
     void toCode(PrettyStream &pretty) const override;
     void analyseMemoryFlow(MFFunctionAnalyser *analyser, MFFlowCategory type) override {}
 
+    const std::u32string& value() const { return value_; }
+
 private:
     std::u32string value_;
     unsigned int varId_;
@@ -35,6 +38,7 @@ public:
     Type analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) override;
     explicit ASTBooleanFalse(const SourcePosition &p) : ASTExpr(p) {}
     Value* generate(FunctionCodeGenerator *fg) const override;
+    llvm::Constant* generateConstant(FunctionCodeGenerator *fg) const override;
 
     void toCode(PrettyStream &pretty) const override;
     void analyseMemoryFlow(MFFunctionAnalyser *, MFFlowCategory) override {}
@@ -45,6 +49,7 @@ public:
     Type analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) override;
     explicit ASTBooleanTrue(const SourcePosition &p) : ASTExpr(p) {}
     Value* generate(FunctionCodeGenerator *fg) const override;
+    llvm::Constant* generateConstant(FunctionCodeGenerator *fg) const override;
 
     void toCode(PrettyStream &pretty) const override;
     void analyseMemoryFlow(MFFunctionAnalyser *, MFFlowCategory) override {}
@@ -59,10 +64,15 @@ public:
 
     Type analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) override;
     Value* generate(FunctionCodeGenerator *fg) const override;
+    llvm::Constant* generateConstant(FunctionCodeGenerator *fg) const override;
 
     void toCode(PrettyStream &pretty) const override;
     void analyseMemoryFlow(MFFunctionAnalyser *, MFFlowCategory) override {}
 
+    /// Returns true if this literal represents the integer 0.
+    bool isIntegerZero() const { return type_ == NumberType::Integer && integerValue_ == 0; }
+    int64_t integerValue() const { return integerValue_; }
+
 private:
     enum class NumberType {
         Double, Integer, Byte
@@ -85,7 +95,12 @@ public:
     void analyseMemoryFlow(MFFunctionAnalyser *, MFFlowCategory) override;
 
 private:
+    /// The number of bytes assumed for a value whose length is not known at compile time.
+    static constexpr int64_t kEstimatedValueLength = 16;
+
     std::vector<std::shared_ptr<ASTExpr>> values_;
+    /// The initial capacity of the 🔠, estimated from the lengths of the string literals among the values.
+    std::shared_ptr<ASTExpr> capacity_;
     Type type_ = Type::noReturn();
 };
 
@@ -95,6 +110,12 @@ public:
     Type analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) override;
     void addValue(const std::shared_ptr<ASTExpr> &value) { values_.emplace_back(value); }
     Value* generate(FunctionCodeGenerator *fg) const override;
+    /// If all values of the literal are constants, the list storage is emitted as global variable whose control
+    /// block is the ignore block. The storage is copied by 🍨 before it is mutated for the first time.
+    ///
+    /// The result is cached, so that callers probing whether the literal is constant, like ASTDictionaryLiteral,
+    /// do not emit the storage again when the literal is generated.
+    llvm::Constant* generateConstant(FunctionCodeGenerator *fg) const override;
 
     void toCode(PrettyStream &pretty) const override;
     void analyseMemoryFlow(MFFunctionAnalyser *, MFFlowCategory) override;
@@ -102,6 +123,10 @@ public:
 private:
     std::vector<std::shared_ptr<ASTExpr>> values_;
     Type type_ = Type::noReturn();
+    mutable llvm::Constant *constant_ = nullptr;
+    mutable bool constantGenerated_ = false;
+
+    llvm::Constant* buildConstant(FunctionCodeGenerator *fg) const;
 };
 
 class ASTDictionaryLiteral final : public ASTExpr {
@@ -117,6 +142,14 @@ public:
 private:
     std::vector<std::shared_ptr<ASTExpr>> values_;
     Type type_ = Type::noReturn();
+
+    /// Builds the dictionary by calling the initializer and the subscript of the dictionary type.
+    /// @returns A pointer to the dictionary.
+    Value* buildDictionary(FunctionCodeGenerator *fg) const;
+    /// Builds the dictionary once and caches it in a global variable. Every evaluation of the literal then retains
+    /// the cached dictionary, which is copied by 🍯 before it is mutated.
+    /// This is only used if all keys and values are constants.
+    Value* buildCachedDictionary(FunctionCodeGenerator *fg) const;
 };
 
 class ASTThis : public ASTExpr {
@@ -14,29 +14,49 @@
 #include "Generation/FunctionCodeGenerator.hpp"
 #include "Generation/StringPool.hpp"
 #include "Types/Class.hpp"
+#include <algorithm>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/GlobalVariable.h>
 
 namespace EmojicodeCompiler {
 
 Value* ASTStringLiteral::generate(FunctionCodeGenerator *fg) const {
-    return fg->generator()->stringPool().pool(value_);
+    return generateConstant(fg);
+}
+
+llvm::Constant* ASTStringLiteral::generateConstant(FunctionCodeGenerator *fg) const {
+    return llvm::cast<llvm::Constant>(fg->generator()->stringPool().pool(value_));
 }
 
 Value* ASTBooleanTrue::generate(FunctionCodeGenerator *fg) const {
+    return generateConstant(fg);
+}
+
+llvm::Constant* ASTBooleanTrue::generateConstant(FunctionCodeGenerator *fg) const {
     return llvm::ConstantInt::getTrue(fg->generator()->context());
 }
 
 Value* ASTBooleanFalse::generate(FunctionCodeGenerator *fg) const {
+    return generateConstant(fg);
+}
+
+llvm::Constant* ASTBooleanFalse::generateConstant(FunctionCodeGenerator *fg) const {
     return llvm::ConstantInt::getFalse(fg->generator()->context());
 }
 
 Value* ASTNumberLiteral::generate(FunctionCodeGenerator *fg) const {
+    return generateConstant(fg);
+}
+
+llvm::Constant* ASTNumberLiteral::generateConstant(FunctionCodeGenerator *fg) const {
+    auto &context = fg->generator()->context();
     switch (type_) {
         case NumberType::Byte:
-            return fg->int8(integerValue_);
+            return llvm::ConstantInt::get(llvm::Type::getInt8Ty(context), integerValue_);
         case NumberType::Integer:
-            return fg->int64(integerValue_);
+            return llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), integerValue_);
         case NumberType::Double:
-            return llvm::ConstantFP::get(llvm::Type::getDoubleTy(fg->generator()->context()), doubleValue_);
+            return llvm::ConstantFP::get(llvm::Type::getDoubleTy(context), doubleValue_);
     }
 }
 
@@ -56,6 +76,20 @@ Value* ASTNoValue::generate(FunctionCodeGenerator *fg) const {
 }
 
 Value* ASTDictionaryLiteral::generate(FunctionCodeGenerator *fg) const {
+    auto isConstant = !values_.empty() && std::all_of(values_.begin(), values_.end(), [fg](auto &value) {
+        return value->generateConstant(fg) != nullptr;
+    });
+    auto dictType = fg->typeHelper().llvmTypeFor(type_);
+    if (isConstant && dictType->getStructNumElements() == 1 && dictType->getStructElementType(0)->isPointerTy()) {
+        return buildCachedDictionary(fg);
+    }
+
+    auto dict = buildDictionary(fg);
+    handleResult(fg, nullptr, dict);
+    return fg->builder().CreateLoad(dict);
+}
+
+Value* ASTDictionaryLiteral::buildDictionary(FunctionCodeGenerator *fg) const {
     auto init = type_.typeDefinition()->lookupInitializer(U"🐴");
     auto capacity = std::make_shared<ASTNumberLiteral>(static_cast<int64_t>(values_.size() / 2), U"", position());
 
@@ -67,11 +101,48 @@ Value* ASTDictionaryLiteral::generate(FunctionCodeGenerator *fg) const {
         auto method = type_.typeDefinition()->lookupMethod(U"🐽", Mood::Assignment);
         CallCodeGenerator(fg, CallType::StaticDispatch).generate(dict, type_, args, method);
     }
+    return dict;
+}
+
+Value* ASTDictionaryLiteral::buildCachedDictionary(FunctionCodeGenerator *fg) const {
+    // The hash of a string depends on a seed chosen at run time, therefore the dictionary cannot be built at
+    // compile time. The dictionary consists of a single pointer, which is published with a compare-and-swap. If
+    // multiple threads evaluate the literal for the first time concurrently, every thread but the first to publish
+    // releases the dictionary it built.
+    auto dictType = llvm::cast<llvm::StructType>(fg->typeHelper().llvmTypeFor(type_));
+    auto cache = new llvm::GlobalVariable(*fg->generator()->module(), dictType, false,
+                                          llvm::GlobalValue::LinkageTypes::PrivateLinkage,
+                                          llvm::Constant::getNullValue(dictType), "dictionary");
+    auto pointerType = dictType->getElementType(0);
+    auto alignment = fg->generator()->querySize(pointerType);
+    auto firstPtr = fg->builder().CreateConstInBoundsGEP2_32(dictType, cache, 0, 0);
+    auto first = fg->builder().CreateLoad(firstPtr);
+    first->setAtomic(llvm::AtomicOrdering::Acquire);
+    first->setAlignment(alignment);
+
+    fg->createIf(fg->builder().CreateIsNull(first), [this, fg, dictType, pointerType, firstPtr]() {
+        auto built = buildDictionary(fg);
+        auto pointer = fg->builder().CreateLoad(fg->builder().CreateConstInBoundsGEP2_32(dictType, built, 0, 0));
+        auto exchange = fg->builder().CreateAtomicCmpXchg(firstPtr, llvm::Constant::getNullValue(pointerType),
+                                                          pointer, llvm::AtomicOrdering::AcquireRelease,
+                                                          llvm::AtomicOrdering::Acquire);
+        fg->createIf(fg->builder().CreateNot(fg->builder().CreateExtractValue(exchange, 1)), [this, fg, built]() {
+            fg->releaseByReference(built, type_);
+        });
+    });
+
+    auto dict = fg->createEntryAlloca(dictType);
+    fg->builder().CreateStore(fg->builder().CreateLoad(cache), dict);
+    fg->retain(dict, type_);
     handleResult(fg, nullptr, dict);
     return fg->builder().CreateLoad(dict);
 }
 
 Value* ASTListLiteral::generate(FunctionCodeGenerator *fg) const {
+    if (auto constant = generateConstant(fg)) {
+        return constant;
+    }
+
     auto init = type_.typeDefinition()->lookupInitializer(U"🐴");
     auto capacity = std::make_shared<ASTNumberLiteral>(static_cast<int64_t>(values_.size()), U"", position());
 
@@ -86,16 +157,60 @@ Value* ASTListLiteral::generate(FunctionCodeGenerator *fg) const {
     return fg->builder().CreateLoad(list);
 }
 
-Value* ASTConcatenateLiteral::generate(FunctionCodeGenerator *fg) const {
-    auto init = type_.typeDefinition()->lookupInitializer(U"🔡");
+llvm::Constant* ASTListLiteral::generateConstant(FunctionCodeGenerator *fg) const {
+    if (!constantGenerated_) {
+        constant_ = buildConstant(fg);
+        constantGenerated_ = true;
+    }
+    return constant_;
+}
 
-    auto it = values_.begin();
-    auto builder = ASTInitialization::initObject(fg, ASTArguments(position(), { *it++ }), init, type_, true);
+llvm::Constant* ASTListLiteral::buildConstant(FunctionCodeGenerator *fg) const {
+    auto &ivars = type_.typeDefinition()->instanceVariables();
+    if (values_.empty() || ivars.size() != 1 || ivars.front().type->type().type() != TypeType::Class) {
+        return nullptr;
+    }
 
-    for (auto end = values_.end(); it != end; it++) {
-        auto args = ASTArguments(position(), { *it });
-        auto method = type_.typeDefinition()->lookupMethod({ 0x1F43B }, Mood::Imperative);
-        CallCodeGenerator(fg, CallType::StaticDispatch).generate(builder, type_, args, method);
+    std::vector<llvm::Constant *> elements;
+    for (auto &value : values_) {
+        auto constant = value->generateConstant(fg);
+        if (constant == nullptr || (!elements.empty() && constant->getType() != elements.front()->getType())) {
+            return nullptr;
+        }
+        elements.emplace_back(constant);
+    }
+
+    auto generator = fg->generator();
+    auto arrayType = llvm::ArrayType::get(elements.front()->getType(), elements.size());
+    auto dataConstant = llvm::ConstantStruct::getAnon({
+        generator->declarator().ignoreBlockPtr(), llvm::ConstantArray::get(arrayType, elements)
+    });
+    auto data = new llvm::GlobalVariable(*generator->module(), dataConstant->getType(), true,
+                                         llvm::GlobalValue::LinkageTypes::PrivateLinkage, dataConstant);
+
+    auto listType = llvm::cast<llvm::StructType>(fg->typeHelper().llvmTypeFor(type_));
+    auto storagePtrType = llvm::cast<llvm::PointerType>(listType->getElementType(0));
+    auto storageType = llvm::cast<llvm::StructType>(storagePtrType->getElementType());
+    auto count = llvm::ConstantInt::get(llvm::Type::getInt64Ty(generator->context()), elements.size());
+    auto storageConstant = llvm::ConstantStruct::get(storageType, {
+        generator->declarator().ignoreBlockPtr(),
+        ivars.front().type->type().klass()->classInfo(),
+        llvm::ConstantExpr::getBitCast(data, llvm::Type::getInt8PtrTy(generator->context())),
+        count, count
+    });
+    auto storage = new llvm::GlobalVariable(*generator->module(), storageType, true,
+                                            llvm::GlobalValue::LinkageTypes::PrivateLinkage, storageConstant, "list");
+    return llvm::ConstantStruct::get(listType, storage);
+}
+
+Value* ASTConcatenateLiteral::generate(FunctionCodeGenerator *fg) const {
+    auto init = type_.typeDefinition()->lookupInitializer(U"🐧");
+    auto builder = ASTInitialization::initObject(fg, ASTArguments(position(), { capacity_ }), init, type_, true);
+
+    auto append = type_.typeDefinition()->lookupMethod({ 0x1F43B }, Mood::Imperative);
+    for (auto &value : values_) {
+        CallCodeGenerator(fg, CallType::StaticDispatch).generate(builder, type_, ASTArguments(position(), { value }),
+                                                                 append);
     }
     auto method = type_.typeDefinition()->lookupMethod({ 0x1F521 }, Mood::Imperative);
     auto str = CallCodeGenerator(fg, CallType::StaticDispatch).generate(builder, type_,
@@ -22,6 +22,8 @@ public:
             assert(this->variableType().isManaged());
         }
 
+    using AccessesAnyVariable::id;
+
     void analyseMemoryFlow(MFFunctionAnalyser *analyser) override {}
     void analyse(FunctionAnalyser *) final {}
     void toCode(PrettyStream &pretty) const override {}
@@ -7,6 +7,7 @@
 //
 
 #include "ASTMethod.hpp"
+#include "ASTLiterals.hpp"
 #include "ASTVariables.hpp"
 #include "Analysis/FunctionAnalyser.hpp"
 #include "Compiler.hpp"
@@ -177,6 +178,36 @@ bool ASTMethodable::builtIn(ExpressionAnalyser *analyser, const Type &type, cons
             return true;
         }
     }
+    else if (analyser->compiler()->isVectorType(type.valueType())) {
+        if (name.front() == 0x1F43D) {
+            builtIn_ = BuiltInType::VectorExtract;
+            return true;
+        }
+        if (name.front() == 0x270F) {
+            builtIn_ = BuiltInType::VectorInsert;
+            return true;
+        }
+        if (name.front() == 0x1F500) {
+            builtIn_ = BuiltInType::VectorSelect;
+            return true;
+        }
+        if (name.front() == 0x1F503) {
+            builtIn_ = BuiltInType::VectorShuffle;
+            return true;
+        }
+        if (name.front() == 0x1F9FE) {
+            builtIn_ = BuiltInType::VectorSum;
+            return true;
+        }
+        if (name.front() == 0x1F4C9) {
+            builtIn_ = BuiltInType::VectorMin;
+            return true;
+        }
+        if (name.front() == 0x1F4C8) {
+            builtIn_ = BuiltInType::VectorMax;
+            return true;
+        }
+    }
     else if (type.typeDefinition() == analyser->compiler()->sMemory) {
         if (name.front() == 0x1F43D) {
             builtIn_ = args_.mood() == Mood::Assignment ? BuiltInType::Store : BuiltInType::Load;
@@ -194,12 +225,64 @@ bool ASTMethodable::builtIn(ExpressionAnalyser *analyser, const Type &type, cons
             builtIn_ = BuiltInType::MemorySet;
             return true;
         }
+        if (name.front() == 0x1F9FD) {
+            builtIn_ = BuiltInType::MemoryIsTriviallyCopyable;
+            return true;
+        }
     }
     return false;
 }
 
 Type ASTMethod::analyse(ExpressionAnalyser *analyser, const TypeExpectation &expectation) {
-    return analyseMethodCall(analyser, name_, callee_);
+    auto type = analyseMethodCall(analyser, name_, callee_);
+    if (builtIn_ == BuiltInType::VectorShuffle) {
+        analyseShuffleMask(analyser);
+    }
+    if (isIndexProvenInBounds(analyser)) {
+        // Both methods have the same signature. As the index is valid, calling the unsafe method is safe.
+        method_ = calleeType_.typeDefinition()->lookupMethod(U"🐾", Mood::Imperative);
+    }
+    return type;
+}
+
+void ASTMethod::analyseShuffleMask(ExpressionAnalyser *analyser) {
+    auto compiler = analyser->compiler();
+    auto valueType = calleeType_.valueType();
+    unsigned lanes = valueType == compiler->sRealVector ? 4 : (valueType == compiler->sIntegerVector ? 8 : 16);
+    for (unsigned i = 0; i < lanes; i++) {
+        auto &arg = args_.args()[i / 8];
+        auto literal = std::dynamic_pointer_cast<ASTNumberLiteral>(arg);
+        if (literal == nullptr) {
+            throw CompilerError(arg->position(), "The pattern passed to 🔃 must be an integer literal.");
+        }
+        auto lane = static_cast<uint32_t>((literal->integerValue() >> (4 * (i % 8))) & 0xF);
+        if (lane >= lanes) {
+            throw CompilerError(arg->position(), "The pattern selects lane ", lane, " but the vector only has ",
+                                lanes, " lanes.");
+        }
+        shuffleMask_.push_back(lane);
+    }
+}
+
+bool ASTMethod::isIndexProvenInBounds(ExpressionAnalyser *analyser) const {
+    if (name_ != U"🐽" || args_.mood() != Mood::Imperative || args_.args().size() != 1) {
+        return false;
+    }
+    auto compiler = analyser->compiler();
+    if (!(calleeType_.type() == TypeType::ValueType && calleeType_.valueType() == compiler->sList) &&
+        !(calleeType_.type() == TypeType::Class && calleeType_.klass() == compiler->sData)) {
+        return false;
+    }
+    if (calleeType_.typeDefinition()->lookupMethod(U"🐾", Mood::Imperative) == nullptr) {
+        return false;
+    }
+    if (indexInBounds_) {
+        return true;
+    }
+    auto collection = std::dynamic_pointer_cast<ASTGetVariable>(callee_);
+    auto index = std::dynamic_pointer_cast<ASTGetVariable>(args_.args().front());
+    return collection != nullptr && index != nullptr && !collection->inInstanceScope() &&
+           !index->inInstanceScope() && analyser->isIndexInBounds(index->id(), collection->id());
 }
 
 void ASTMethod::analyseMemoryFlow(MFFunctionAnalyser *analyser, MFFlowCategory type) {
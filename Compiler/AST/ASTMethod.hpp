@@ -11,13 +11,19 @@
 
 #include "ASTExpr.hpp"
 #include "Functions/CallType.h"
+#include <functional>
 #include <utility>
+#include <vector>
 
 namespace EmojicodeCompiler {
 
 class FunctionAnalyser;
 
 class ASTMethodable : public ASTExpr {
+public:
+    /// @returns The function called by this node or `nullptr` if no function is called, e.g. for built-ins.
+    Function* method() const { return method_; }
+
 protected:
     explicit ASTMethodable(const SourcePosition &p) : ASTExpr(p), args_(p) {}
     ASTMethodable(const SourcePosition &p, ASTArguments args) : ASTExpr(p), args_(std::move(args)) {}
@@ -37,7 +43,10 @@ protected:
         IntegerLess, IntegerLessOrEqual, IntegerLeftShift, IntegerRightShift, IntegerOr, IntegerAnd, IntegerXor,
         IntegerRemainder, IntegerToDouble, IntegerNot, IntegerInverse,
         BooleanAnd, BooleanOr, BooleanNegate,
-        Equal, Store, Load, Release, MemoryMove, MemorySet, IsNoValueLeft, IsNoValueRight, Multiprotocol,
+        Equal, Store, Load, Release, MemoryMove, MemorySet, MemoryIsTriviallyCopyable, IsNoValueLeft, IsNoValueRight, Multiprotocol,
+        VectorAdd, VectorSubstract, VectorMultiply, VectorDivide, VectorRemainder, VectorAnd, VectorOr, VectorXor,
+        VectorLeftShift, VectorRightShift, VectorEqual, VectorLess, VectorLessOrEqual, VectorGreater,
+        VectorGreaterOrEqual, VectorExtract, VectorInsert, VectorSelect, VectorShuffle, VectorSum, VectorMin, VectorMax,
     };
 
     BuiltInType builtIn_ = BuiltInType::None;
@@ -70,13 +79,39 @@ public:
     void analyseMemoryFlow(MFFunctionAnalyser *analyser, MFFlowCategory type) override;
     void mutateReference(ExpressionAnalyser *analyser) final;
 
+    const std::u32string& name() const { return name_; }
+    const std::shared_ptr<ASTExpr>& callee() const { return callee_; }
+
+    /// Informs this node that its only argument is certainly a valid index for 🐽. If the callee is a 🍨 or 📇,
+    /// the unchecked 🐾 is called instead.
+    void setIndexInBounds() { indexInBounds_ = true; }
+
 private:
     std::u32string name_;
     std::shared_ptr<ASTExpr> callee_;
+    bool indexInBounds_ = false;
+    /// The lanes selected by the pattern passed to 🔃 on a SIMD vector type.
+    std::vector<uint32_t> shuffleMask_;
+
+    /// Reads the integer literals passed to 🔃 into shuffleMask_.
+    void analyseShuffleMask(ExpressionAnalyser *analyser);
+
+    /// Returns true if this is a call to 🐽 whose argument has been proven to be a valid index.
+    bool isIndexProvenInBounds(ExpressionAnalyser *analyser) const;
 
     llvm::Value* buildMemoryAddress(FunctionCodeGenerator *fg, llvm::Value *memory, llvm::Value *offset,
                                     const Type &type) const;
     llvm::Value* buildAddOffsetAddress(FunctionCodeGenerator *fg, llvm::Value *memory, llvm::Value *offset) const;
+    /// Generates 🧽 of 🧠. The result is constant unless the values are boxes, whose box infos are then inspected
+    /// at run-time.
+    llvm::Value* buildIsTriviallyCopyable(FunctionCodeGenerator *fg, llvm::Value *memory) const;
+
+    /// Generates the built-in methods of the SIMD vector types.
+    /// @param lanes The value of the callee.
+    llvm::Value* generateVectorBuiltIn(FunctionCodeGenerator *fg, llvm::Value *lanes) const;
+    /// Combines all lanes of @c vector by applying @c op pairwise in log2(lanes) steps.
+    llvm::Value* buildVectorReduction(FunctionCodeGenerator *fg, llvm::Value *vector,
+                                      const std::function<llvm::Value* (llvm::Value *, llvm::Value *)> &op) const;
 };
     
 }  // namespace EmojicodeCompiler
@@ -8,6 +8,7 @@
 
 #include "ASTMethod.hpp"
 #include "Generation/CallCodeGenerator.hpp"
+#include "Generation/Declarator.hpp"
 #include "Generation/FunctionCodeGenerator.hpp"
 
 namespace EmojicodeCompiler {
@@ -27,7 +28,7 @@ Value* ASTMethod::generate(FunctionCodeGenerator *fg) const {
             case BuiltInType::BooleanNegate:
                 return fg->builder().CreateICmpEQ(llvm::ConstantInt::getFalse(fg->generator()->context()), v);
             case BuiltInType::Store: {
-                auto type = args_.genericArguments().front()->type();
+                auto type = fg->typeHelper().actualType(args_.genericArguments().front()->type());
                 auto ptr = buildMemoryAddress(fg, v, args_.args()[1]->generate(fg), type);
                 auto val = args_.args().front()->generate(fg);
                 fg->builder().CreateStore(val, ptr);
@@ -41,7 +42,7 @@ Value* ASTMethod::generate(FunctionCodeGenerator *fg) const {
                 return buildMemoryAddress(fg, v, args_.args().front()->generate(fg), type);
             }
             case BuiltInType::Release: {
-                auto type = args_.genericArguments().front()->type();
+                auto type = fg->typeHelper().actualType(args_.genericArguments().front()->type());
                 if (type.isManaged()) {
                     auto ptr = buildMemoryAddress(fg, v, args_.args().front()->generate(fg), type);
                     fg->releaseByReference(ptr, type);
@@ -60,6 +61,16 @@ Value* ASTMethod::generate(FunctionCodeGenerator *fg) const {
                                            args_.args()[0]->generate(fg), args_.args()[2]->generate(fg), 0);
                 return nullptr;
             }
+            case BuiltInType::MemoryIsTriviallyCopyable:
+                return buildIsTriviallyCopyable(fg, v);
+            case BuiltInType::VectorExtract:
+            case BuiltInType::VectorInsert:
+            case BuiltInType::VectorSelect:
+            case BuiltInType::VectorShuffle:
+            case BuiltInType::VectorSum:
+            case BuiltInType::VectorMin:
+            case BuiltInType::VectorMax:
+                return generateVectorBuiltIn(fg, v);
             case BuiltInType::Multiprotocol:
                 return MultiprotocolCallCodeGenerator(fg, callType_).generate(callee_->generate(fg), calleeType_, args_,
                                                                               method_, multiprotocolN_);
@@ -72,6 +83,72 @@ Value* ASTMethod::generate(FunctionCodeGenerator *fg) const {
                                                                       args_, method_));
 }
 
+Value* ASTMethod::generateVectorBuiltIn(FunctionCodeGenerator *fg, llvm::Value *lanes) const {
+    auto &builder = fg->builder();
+    auto vector = fg->buildVectorFromLanes(lanes);
+    auto laneType = llvm::cast<llvm::VectorType>(vector->getType())->getElementType();
+    auto n = vector->getType()->getVectorNumElements();
+    auto real = laneType->isFloatingPointTy();
+    // The lanes of 🎚 are only 32 bits wide but are read and written as 🔢.
+    auto toElement = [&builder, laneType](Value *lane) {
+        return laneType->isIntegerTy(32) ? builder.CreateSExt(lane, builder.getInt64Ty()) : lane;
+    };
+
+    switch (builtIn_) {
+        case BuiltInType::VectorExtract:
+            return toElement(builder.CreateExtractElement(vector, args_.args()[0]->generate(fg)));
+        case BuiltInType::VectorInsert: {
+            auto index = args_.args()[0]->generate(fg);
+            auto value = builder.CreateTrunc(args_.args()[1]->generate(fg), laneType);
+            return fg->buildLanesFromVector(builder.CreateInsertElement(vector, value, index));
+        }
+        case BuiltInType::VectorSelect: {
+            auto mask = fg->buildVectorFromMask(args_.args()[0]->generate(fg), n);
+            auto other = fg->buildVectorFromLanes(args_.args()[1]->generate(fg));
+            return fg->buildLanesFromVector(builder.CreateSelect(mask, other, vector));
+        }
+        case BuiltInType::VectorShuffle: {
+            auto undef = llvm::UndefValue::get(vector->getType());
+            return fg->buildLanesFromVector(builder.CreateShuffleVector(vector, undef, shuffleMask_));
+        }
+        case BuiltInType::VectorSum:
+            if (real) {
+                return buildVectorReduction(fg, vector, [&builder](Value *a, Value *b) {
+                    return builder.CreateFAdd(a, b);
+                });
+            }
+            // Integer lanes are summed as 🔢 so that the sum does not overflow.
+            vector = builder.CreateSExt(vector, llvm::VectorType::get(builder.getInt64Ty(), n));
+            return buildVectorReduction(fg, vector, [&builder](Value *a, Value *b) {
+                return builder.CreateAdd(a, b);
+            });
+        case BuiltInType::VectorMin:
+            return toElement(buildVectorReduction(fg, vector, [&builder, real](Value *a, Value *b) {
+                return builder.CreateSelect(real ? builder.CreateFCmpOLT(a, b) : builder.CreateICmpSLT(a, b), a, b);
+            }));
+        case BuiltInType::VectorMax:
+            return toElement(buildVectorReduction(fg, vector, [&builder, real](Value *a, Value *b) {
+                return builder.CreateSelect(real ? builder.CreateFCmpOGT(a, b) : builder.CreateICmpSGT(a, b), a, b);
+            }));
+        default:
+            throw std::logic_error("Not a vector built-in");
+    }
+}
+
+Value* ASTMethod::buildVectorReduction(FunctionCodeGenerator *fg, llvm::Value *vector,
+                                       const std::function<llvm::Value* (llvm::Value *, llvm::Value *)> &op) const {
+    auto n = vector->getType()->getVectorNumElements();
+    auto undef = llvm::UndefValue::get(vector->getType());
+    for (unsigned width = n / 2; width > 0; width /= 2) {
+        std::vector<uint32_t> mask(n);
+        for (unsigned i = 0; i < n; i++) {
+            mask[i] = (i + width) % n;
+        }
+        vector = op(vector, fg->builder().CreateShuffleVector(vector, undef, mask));
+    }
+    return fg->builder().CreateExtractElement(vector, static_cast<uint64_t>(0));
+}
+
 Value* ASTMethod::buildAddOffsetAddress(FunctionCodeGenerator *fg, llvm::Value *memory, llvm::Value *offset) const {
     auto addOffset = fg->builder().CreateAdd(offset, fg->sizeOf(llvm::Type::getInt8PtrTy(fg->generator()->context())));
     return fg->builder().CreateGEP(memory, addOffset);
@@ -83,4 +160,20 @@ Value* ASTMethod::buildMemoryAddress(FunctionCodeGenerator *fg, llvm::Value *mem
     return fg->builder().CreateBitCast(buildAddOffsetAddress(fg, memory, offset), ptrType);
 }
 
+Value* ASTMethod::buildIsTriviallyCopyable(FunctionCodeGenerator *fg, llvm::Value *memory) const {
+    auto type = fg->typeHelper().actualType(args_.genericArguments().front()->type());
+    if (fg->typeHelper().isTriviallyCopyable(type)) {
+        return llvm::ConstantInt::getTrue(fg->generator()->context());
+    }
+    // Boxes for protocols point to a conformance instead of a box info, see FunctionCodeGenerator::manageBox.
+    if (type.type() != TypeType::Box || type.boxedFor().type() == TypeType::Protocol ||
+        type.boxedFor().type() == TypeType::MultiProtocol) {
+        return llvm::ConstantInt::getFalse(fg->generator()->context());
+    }
+    auto boxes = buildAddOffsetAddress(fg, memory, args_.args()[0]->generate(fg));
+    return fg->builder().CreateCall(fg->generator()->declarator().boxesAreTriviallyCopyable(), {
+        boxes, args_.args()[1]->generate(fg), fg->sizeOf(fg->typeHelper().box())
+    });
+}
+
 }  // namespace EmojicodeCompiler
@@ -7,6 +7,7 @@
 //
 
 #include "ASTStatements.hpp"
+#include "ASTMethod.hpp"
 #include "Analysis/FunctionAnalyser.hpp"
 #include "Compiler.hpp"
 #include "Functions/FunctionType.hpp"
@@ -92,6 +93,10 @@ void ASTReturn::analyse(FunctionAnalyser *analyser) {
     else {
         analyser->comply(type, TypeExpectation(analyser->function()->returnType()->type()), &value_);
     }
+    if (auto call = std::dynamic_pointer_cast<ASTMethodable>(value_)) {
+        selfCall_ = call->method() == analyser->function();
+        tailCallDemanded_ = selfCall_ && analyser->function()->demandsTailCalls();
+    }
 }
 
 void ASTReturn::returnReference(FunctionAnalyser *analyser, Type type) {
@@ -141,7 +146,11 @@ void ASTRaise::analyse(FunctionAnalyser *analyser) {
 void ASTReturn::analyseMemoryFlow(MFFunctionAnalyser *analyser) {
     if (value_ != nullptr && !initReturn_) {
         analyser->take(value_.get());
+        if (selfCall_) {
+            analyser->collectVariableGets(&valueVariables_);
+        }
         value_->analyseMemoryFlow(analyser, MFFlowCategory::Return);
+        analyser->stopCollectingVariableGets();
     }
 }
 
@@ -130,6 +130,22 @@ protected:
     std::shared_ptr<ASTExpr> value_;
     std::vector<std::unique_ptr<ASTRelease>> releases_;
     bool initReturn_ = false;
+
+private:
+    /// True if value_ is a call to the function in which this statement is located.
+    bool selfCall_ = false;
+    /// True if the function was marked with ➰ and selfCall_ is true.
+    bool tailCallDemanded_ = false;
+    /// The IDs of all local variables whose values are retrieved by value_.
+    std::vector<VariableID> valueVariables_;
+
+    /// Returns true if the releases can be moved before value_ is evaluated, which is the case if value_ does not
+    /// retrieve any variable that is released.
+    bool canReleaseBeforeValue() const;
+    /// Generates the releases, then value_ and marks the call as `musttail` if possible.
+    void generateTailCall(FunctionCodeGenerator *fg) const;
+    /// Reports that this ↩️ cannot be compiled as tail call if the function demands it.
+    void reportNoTailCall(FunctionCodeGenerator *fg, const char *reason) const;
 };
 
 class ASTRaise final : public ASTReturn, private ErrorSelfDestructing {
@@ -8,11 +8,14 @@
 
 #include "AST/ASTMemory.hpp"
 #include "ASTStatements.hpp"
+#include "Compiler.hpp"
 #include "Generation/CallCodeGenerator.hpp"
 #include "Generation/Declarator.hpp"
 #include "Generation/FunctionCodeGenerator.hpp"
 #include "Scoping/IDScoper.hpp"
 #include "Types/Class.hpp"
+#include <algorithm>
+#include <llvm/Analysis/ValueTracking.h>
 
 namespace EmojicodeCompiler {
 
@@ -37,7 +40,51 @@ void ASTReturn::release(FunctionCodeGenerator *fg) const {
     }
 }
 
+bool ASTReturn::canReleaseBeforeValue() const {
+    return std::none_of(releases_.begin(), releases_.end(), [this](const std::unique_ptr<ASTRelease> &release) {
+        return std::find(valueVariables_.begin(), valueVariables_.end(), release->id()) != valueVariables_.end();
+    });
+}
+
+void ASTReturn::reportNoTailCall(FunctionCodeGenerator *fg, const char *reason) const {
+    if (tailCallDemanded_) {
+        fg->compiler()->error(CompilerError(position(), "➰ Cannot compile ↩️ as tail call: ", reason));
+    }
+}
+
+void ASTReturn::generateTailCall(FunctionCodeGenerator *fg) const {
+    release(fg);
+    auto val = value_->generate(fg);
+
+    auto call = llvm::dyn_cast<llvm::CallInst>(val);
+    auto &dataLayout = fg->generator()->module()->getDataLayout();
+    if (call == nullptr || call->getCalledFunction() != fg->builder().GetInsertBlock()->getParent()) {
+        reportNoTailCall(fg, "The method is not dispatched statically. Consider making it 🔒 or 🔏.");
+    }
+    else if (fg->hasTemporaryObjects()) {
+        reportNoTailCall(fg, "Temporary values must be released after the call.");
+    }
+    else if (std::any_of(call->arg_begin(), call->arg_end(), [&dataLayout](const llvm::Use &arg) {
+        return llvm::isa<llvm::AllocaInst>(llvm::GetUnderlyingObject(arg.get(), dataLayout));
+    })) {
+        reportNoTailCall(fg, "A pointer to a local variable is passed.");
+    }
+    else {
+        call->setTailCallKind(llvm::CallInst::TCK_MustTail);
+    }
+
+    fg->releaseTemporaryObjects();
+    fg->builder().CreateRet(val);
+}
+
 void ASTReturn::generate(FunctionCodeGenerator *fg) const {
+    if (selfCall_) {
+        if (canReleaseBeforeValue()) {
+            generateTailCall(fg);
+            return;
+        }
+        reportNoTailCall(fg, "A variable used in the call must be released after the call.");
+    }
     if (value_) {
         auto val = value_->generate(fg);
         release(fg);
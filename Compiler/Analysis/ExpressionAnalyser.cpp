@@ -82,7 +82,7 @@ Type ExpressionAnalyser::analyseFunctionCall(ASTArguments *node, const Type &typ
     auto genericArgs = transformTypeAstVector(node->genericArguments(), typeContext());
 
     TypeContext typeContext = TypeContext(type, function, &genericArgs);
-    function->requestReificationAndCheck(typeContext, genericArgs, node->position());
+    function->requestReificationAndCheck(typeContext, typeContext, genericArgs, node->position());
 
     for (size_t i = 0; i < function->parameters().size(); i++) {
         expectType(function->parameters()[i].type->type().resolveOn(typeContext), &node->args()[i]);
@@ -9,6 +9,7 @@
 #define ExpressionAnalyser_hpp
 
 #include "PathAnalyser.hpp"
+#include "Scoping/Variable.hpp"
 #include "Types/TypeContext.hpp"
 #include <memory>
 
@@ -41,6 +42,9 @@ public:
     SemanticScoper& scoper() { return *scoper_; }
 
     virtual bool isInUnsafeBlock() const { return false; }
+    /// Returns true if the local variable `index` is known to be a valid index into the collection stored in the
+    /// local variable `collection`.
+    virtual bool isIndexInBounds(VariableID index, VariableID collection) const { return false; }
 
     /// Ensures that the instance is fully initialized, which is required before using $this$ etc.
     ///
@@ -19,6 +19,7 @@
 #include "Types/Class.hpp"
 #include "Types/TypeDefinition.hpp"
 #include "Types/TypeExpectation.hpp"
+#include <algorithm>
 
 namespace EmojicodeCompiler {
 
@@ -65,6 +66,12 @@ void FunctionAnalyser::checkThisUse(const SourcePosition &p) const {
     }
 }
 
+bool FunctionAnalyser::isIndexInBounds(VariableID index, VariableID collection) const {
+    return std::any_of(inBoundsIndices_.begin(), inBoundsIndices_.end(), [index, collection](auto &pair) {
+        return pair.first->id() == index && pair.second == collection;
+    });
+}
+
 void FunctionAnalyser::analyse() {
    scoper_->pushArgumentsScope(function_->parameters(), function_->position());
 
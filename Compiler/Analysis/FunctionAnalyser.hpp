@@ -14,6 +14,7 @@
 namespace EmojicodeCompiler {
 
 class ASTBlock;
+class AccessesAnyVariable;
 
 /// This class is responsible for managing the semantic analysis of a function.
 class FunctionAnalyser : public ExpressionAnalyser {
@@ -35,6 +36,15 @@ public:
     void setInUnsafeBlock(bool v) { inUnsafeBlock_ = v; }
     bool isInUnsafeBlock() const override { return inUnsafeBlock_; }
 
+    /// Records that the local variable accessed by `index` is a valid index into the 🍨 or 📇 in the constant local
+    /// variable `collection` until popInBoundsIndex() is called.
+    /// @param index The node declaring the index variable. Its ID is only read once the node has been analysed.
+    void pushInBoundsIndex(const AccessesAnyVariable *index, VariableID collection) {
+        inBoundsIndices_.emplace_back(index, collection);
+    }
+    void popInBoundsIndex() { inBoundsIndices_.pop_back(); }
+    bool isIndexInBounds(VariableID index, VariableID collection) const override;
+
     void checkThisUse(const SourcePosition &p) const override;
     FunctionType functionType() const override;
 
@@ -44,6 +54,7 @@ private:
     Function *function_;
 
     bool inUnsafeBlock_;
+    std::vector<std::pair<const AccessesAnyVariable *, VariableID>> inBoundsIndices_;
 
     void analyseReturn(ASTBlock *root);
     void analyseInitializationRequirements();
@@ -192,10 +192,15 @@ void Compiler::assignSTypes(Package *s) {
     sReal = getStandardValueType(std::u32string(1, E_HUNDRED_POINTS_SYMBOL), s);
     sMemory = getStandardValueType(U"🧠", s);
     sByte = getStandardValueType(U"💧", s);
+    sRealVector = getStandardValueType(U"🎛", s);
+    sIntegerVector = getStandardValueType(U"🎚", s);
+    sByteVector = getStandardValueType(U"🎹", s);
 
     sString = getStandardClass(U"🔡", s);
     sList = getStandardValueType(U"🍨", s);
     sDictionary = getStandardValueType(U"🍯", s);
+    sRange = getStandardValueType(U"⏩", s);
+    sData = getStandardClass(U"📇", s);
 
     sEnumerable = getStandardProtocol(
             std::u32string(1, E_CLOCKWISE_RIGHTWARDS_AND_LEFTWARDS_OPEN_CIRCLE_ARROWS_WITH_CIRCLED_ONE_OVERLAY), s);
@@ -104,12 +104,22 @@ public:
     Class *sString = nullptr;
     ValueType *sList = nullptr;
     ValueType *sDictionary = nullptr;
+    ValueType *sRange = nullptr;
+    Class *sData = nullptr;
     Protocol *sEnumerable = nullptr;
     ValueType *sBoolean = nullptr;
     ValueType *sInteger = nullptr;
     ValueType *sReal = nullptr;
     ValueType *sMemory = nullptr;
     ValueType *sByte = nullptr;
+    ValueType *sRealVector = nullptr;
+    ValueType *sIntegerVector = nullptr;
+    ValueType *sByteVector = nullptr;
+
+    /// Returns true if @c type is one of the SIMD vector types 🎛, 🎚 and 🎹.
+    bool isVectorType(const ValueType *type) const {
+        return type == sRealVector || type == sIntegerVector || type == sByteVector;
+    }
 
     ~Compiler();
 
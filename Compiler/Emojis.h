@@ -93,6 +93,7 @@ enum Emojis {
     E_GREEN_TEXTBOOK = 0x1F4D7,
     E_BLUE_TEXTBOOK = 0x1F4D8,
     E_SCALES = 0x2696,
+    E_SOAP = 0x1F9FC,
     E_BIOHAZARD = 0x2623,
     E_PERSON_SHRUGGING = 0x1F937,
     E_NO_GESTURE = 0x1F645,
@@ -109,6 +110,7 @@ enum Emojis {
     E_BATTERY = 0x1F50B,
     E_EIGHT_POINTED_STAR = 0x2734,
     E_BAGEL = 0x1F96F,
+    E_CURLY_LOOP = 0x27B0,
 };
 
 }  // namespace EmojicodeCompiler
@@ -124,6 +124,11 @@ public:
 
     bool isInline() const;
 
+    /// Marks this function as demanding that every ↩️ of a call to itself is compiled as a tail call. A compiler error
+    /// is raised for every such return that cannot be.
+    void setDemandsTailCalls() { demandsTailCalls_ = true; }
+    bool demandsTailCalls() const { return demandsTailCalls_; }
+
     void setThunk() { thunk_ = true; }
     bool isThunk() const { return thunk_; }
 
@@ -181,6 +186,7 @@ private:
     Mood mood_;
     bool unsafe_;
     bool forceInline_ = false;
+    bool demandsTailCalls_ = false;
     bool thunk_ = false;
 
     bool mutating_;
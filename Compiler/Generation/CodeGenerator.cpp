@@ -275,6 +275,12 @@ void CodeGenerator::createClassInfo(Class *klass) {
 }
 
 std::pair<llvm::Function*, llvm::Function*> CodeGenerator::buildBoxRetainRelease(const Type &type) {
+    if (!type.isManaged()) {
+        // All box infos of unmanaged types share one function, which allows ejcBoxesAreTriviallyCopyable to tell
+        // them apart from box infos of managed types.
+        return std::make_pair(declarator().boxManageNothing(), declarator().boxManageNothing());
+    }
+
     auto release = llvm::Function::Create(typeHelper().boxRetainRelease(),
                                           llvm::GlobalValue::LinkageTypes::ExternalLinkage, mangleBoxRelease(type),
                                           module_.get());
@@ -287,38 +293,36 @@ std::pair<llvm::Function*, llvm::Function*> CodeGenerator::buildBoxRetainRelease
     auto retainFg = FunctionCodeGenerator(retain, this);
     retainFg.createEntry();
 
-    if (type.isManaged()) {
-        if (!releaseFg.isManagedByReference(type)) {
-            auto objPtr = releaseFg.buildGetBoxValuePtr(release->args().begin(), type);
-            releaseFg.release(releaseFg.builder().CreateLoad(objPtr), type);
+    if (!releaseFg.isManagedByReference(type)) {
+        auto objPtr = releaseFg.buildGetBoxValuePtr(release->args().begin(), type);
+        releaseFg.release(releaseFg.builder().CreateLoad(objPtr), type);
 
-            auto objPtrRetain = retainFg.buildGetBoxValuePtr(retain->args().begin(), type);
-            retainFg.retain(retainFg.builder().CreateLoad(objPtrRetain), type);
-        }
-        else if (typeHelper().isRemote(type)) {
-            auto containedType = typeHelper().llvmTypeFor(type);
-            auto mngType = typeHelper().managable(containedType);
-
-            auto objPtr = releaseFg.buildGetBoxValuePtrAfter(release->args().begin(), mngType->getPointerTo(),
-                                                             containedType->getPointerTo());
-            auto remotePtr = releaseFg.builder().CreateLoad(objPtr);
-            releaseFg.release(releaseFg.managableGetValuePtr(remotePtr), type);
-            releaseFg.release(releaseFg.builder().CreateBitCast(remotePtr, llvm::Type::getInt8PtrTy(context_)),
-                              Type(compiler()->sMemory));
-
-            auto objPtrRetain = retainFg.buildGetBoxValuePtrAfter(retain->args().begin(), mngType->getPointerTo(),
-                                                                  containedType->getPointerTo());
-            auto remotePtrRetain = retainFg.builder().CreateLoad(objPtrRetain);
-            retainFg.retain(retainFg.managableGetValuePtr(remotePtrRetain), type);
-            retainFg.retain(remotePtrRetain, Type(compiler()->sMemory));
-        }
-        else {
-            auto objPtr = releaseFg.buildGetBoxValuePtr(release->args().begin(), type);
-            releaseFg.release(objPtr, type);
+        auto objPtrRetain = retainFg.buildGetBoxValuePtr(retain->args().begin(), type);
+        retainFg.retain(retainFg.builder().CreateLoad(objPtrRetain), type);
+    }
+    else if (typeHelper().isRemote(type)) {
+        auto containedType = typeHelper().llvmTypeFor(type);
+        auto mngType = typeHelper().managable(containedType);
+
+        auto objPtr = releaseFg.buildGetBoxValuePtrAfter(release->args().begin(), mngType->getPointerTo(),
+                                                         containedType->getPointerTo());
+        auto remotePtr = releaseFg.builder().CreateLoad(objPtr);
+        releaseFg.release(releaseFg.managableGetValuePtr(remotePtr), type);
+        releaseFg.release(releaseFg.builder().CreateBitCast(remotePtr, llvm::Type::getInt8PtrTy(context_)),
+                          Type(compiler()->sMemory));
+
+        auto objPtrRetain = retainFg.buildGetBoxValuePtrAfter(retain->args().begin(), mngType->getPointerTo(),
+                                                              containedType->getPointerTo());
+        auto remotePtrRetain = retainFg.builder().CreateLoad(objPtrRetain);
+        retainFg.retain(retainFg.managableGetValuePtr(remotePtrRetain), type);
+        retainFg.retain(remotePtrRetain, Type(compiler()->sMemory));
+    }
+    else {
+        auto objPtr = releaseFg.buildGetBoxValuePtr(release->args().begin(), type);
+        releaseFg.release(objPtr, type);
 
-            auto objPtrRetain = retainFg.buildGetBoxValuePtr(retain->args().begin(), type);
-            retainFg.retain(objPtrRetain, type);
-        }
+        auto objPtrRetain = retainFg.buildGetBoxValuePtr(retain->args().begin(), type);
+        retainFg.retain(objPtrRetain, type);
     }
 
     releaseFg.builder().CreateRetVoid();
@@ -65,6 +65,15 @@ void EmojicodeCompiler::Declarator::declareRunTime() {
     isOnlyReference_->addParamAttr(0, llvm::Attribute::NonNull);
     isOnlyReference_->addParamAttr(0, llvm::Attribute::NoCapture);
 
+    boxManageNothing_ = declareRunTimeFunction("ejcBoxManageNothing", llvm::Type::getVoidTy(generator_->context()),
+                                               generator_->typeHelper().box()->getPointerTo());
+    boxesAreTriviallyCopyable_ = declareRunTimeFunction("ejcBoxesAreTriviallyCopyable",
+                                                        llvm::Type::getInt1Ty(generator_->context()), {
+        llvm::Type::getInt8PtrTy(generator_->context()), llvm::Type::getInt64Ty(generator_->context()),
+        llvm::Type::getInt64Ty(generator_->context())
+    });
+    boxesAreTriviallyCopyable_->addFnAttr(llvm::Attribute::ReadOnly);
+
     ignoreBlock_ = new llvm::GlobalVariable(*generator_->module(), llvm::Type::getInt8Ty(generator_->context()), true,
                                             llvm::GlobalValue::LinkageTypes::ExternalLinkage, nullptr,
                                             "ejcIgnoreBlock");
@@ -48,6 +48,11 @@ public:
     llvm::Function* findProtocolConformance() const { return findProtocolConformance_; }
 
     llvm::Function* isOnlyReference() const { return isOnlyReference_; }
+    /// The retain and release function of boxes of values that are not managed. (ejcBoxManageNothing)
+    llvm::Function* boxManageNothing() const { return boxManageNothing_; }
+    /// Determines whether a number of consecutive boxes only contain values that are not managed.
+    /// (ejcBoxesAreTriviallyCopyable)
+    llvm::Function* boxesAreTriviallyCopyable() const { return boxesAreTriviallyCopyable_; }
 
     llvm::GlobalVariable* ignoreBlockPtr() const { return ignoreBlock_; }
 
@@ -80,6 +85,8 @@ private:
     llvm::Function *releaseMemory_ = nullptr;
     llvm::Function *releaseCapture_ = nullptr;
     llvm::Function *isOnlyReference_ = nullptr;
+    llvm::Function *boxManageNothing_ = nullptr;
+    llvm::Function *boxesAreTriviallyCopyable_ = nullptr;
 
     llvm::Function* declareRunTimeFunction(const char *name, llvm::Type *returnType, llvm::ArrayRef<llvm::Type *> args);
     llvm::Function* declareMemoryRunTimeFunction(const char *name);
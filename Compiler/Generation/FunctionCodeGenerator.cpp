@@ -164,6 +164,37 @@ Value* FunctionCodeGenerator::buildGetOptionalValue(llvm::Value *value, const Ty
     return builder().CreateExtractValue(value, 1);
 }
 
+Value* FunctionCodeGenerator::buildVectorFromLanes(llvm::Value *lanes) {
+    auto arrayType = llvm::cast<llvm::ArrayType>(lanes->getType());
+    auto n = arrayType->getNumElements();
+    llvm::Value *vector = llvm::UndefValue::get(llvm::VectorType::get(arrayType->getElementType(), n));
+    for (unsigned i = 0; i < n; i++) {
+        vector = builder().CreateInsertElement(vector, builder().CreateExtractValue(lanes, i), i);
+    }
+    return vector;
+}
+
+Value* FunctionCodeGenerator::buildLanesFromVector(llvm::Value *vector) {
+    auto vectorType = llvm::cast<llvm::VectorType>(vector->getType());
+    auto n = vectorType->getNumElements();
+    llvm::Value *lanes = llvm::UndefValue::get(llvm::ArrayType::get(vectorType->getElementType(), n));
+    for (unsigned i = 0; i < n; i++) {
+        lanes = builder().CreateInsertValue(lanes, builder().CreateExtractElement(vector, i), i);
+    }
+    return lanes;
+}
+
+Value* FunctionCodeGenerator::buildMaskFromVector(llvm::Value *vector) {
+    auto n = llvm::cast<llvm::VectorType>(vector->getType())->getNumElements();
+    auto bits = builder().CreateBitCast(vector, llvm::Type::getIntNTy(generator()->context(), n));
+    return builder().CreateZExt(bits, llvm::Type::getInt64Ty(generator()->context()));
+}
+
+Value* FunctionCodeGenerator::buildVectorFromMask(llvm::Value *mask, unsigned lanes) {
+    auto bits = builder().CreateTrunc(mask, llvm::Type::getIntNTy(generator()->context(), lanes));
+    return builder().CreateBitCast(bits, llvm::VectorType::get(llvm::Type::getInt1Ty(generator()->context()), lanes));
+}
+
 Value* FunctionCodeGenerator::buildGetBoxValuePtr(Value *box, const Type &type) {
     auto llvmType = typeHelper().llvmTypeFor(type)->getPointerTo();
     return buildGetBoxValuePtr(box, llvmType);
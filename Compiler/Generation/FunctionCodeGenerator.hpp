@@ -99,6 +99,18 @@ public:
     /// Retrieves the value from an optional. If the optional does not have a value, the behavior is undefined.
     llvm::Value* buildGetOptionalValue(llvm::Value *value, const Type &type);
 
+    /// Values of the SIMD vector types 🎛, 🎚 and 🎹 are stored as arrays of their lanes, so that they require no
+    /// more than the alignment of a lane in boxes, objects and 🧠. This method loads the lanes into an LLVM vector.
+    llvm::Value* buildVectorFromLanes(llvm::Value *lanes);
+    /// Converts an LLVM vector into the array representation used for values of the SIMD vector types.
+    /// @see buildVectorFromLanes
+    llvm::Value* buildLanesFromVector(llvm::Value *vector);
+    /// Converts a vector of `i1` into a 🔢 mask, in which bit *i* is set if lane *i* is true.
+    llvm::Value* buildMaskFromVector(llvm::Value *vector);
+    /// Converts a 🔢 mask into a vector of `i1` with @c lanes lanes.
+    /// @see buildMaskFromVector
+    llvm::Value* buildVectorFromMask(llvm::Value *mask, unsigned lanes);
+
     /// Gets a pointer to the pointer to the class info of an object.
     /// @see getClassInfoFromObject
     llvm::Value* buildGetClassInfoPtrFromObject(llvm::Value *object);
@@ -181,6 +193,8 @@ public:
     /// they were added.
     /// @see addTemporaryObject
     void releaseTemporaryObjects();
+    /// @returns True if temporary values were registered that have not been released yet.
+    bool hasTemporaryObjects() const { return !temporaryObjects_.empty(); }
 
 protected:
     virtual void declareArguments(llvm::Function *function);
@@ -67,6 +67,12 @@ LLVMTypeHelper::LLVMTypeHelper(llvm::LLVMContext &context, CodeGenerator *codeGe
     compiler->sBoolean->createUnspecificReification().type = llvm::Type::getInt1Ty(context_);
     compiler->sMemory->createUnspecificReification().type = llvm::Type::getInt8PtrTy(context_);
     compiler->sByte->createUnspecificReification().type = llvm::Type::getInt8Ty(context_);
+    compiler->sRealVector->createUnspecificReification().type =
+            llvm::ArrayType::get(llvm::Type::getDoubleTy(context_), 4);
+    compiler->sIntegerVector->createUnspecificReification().type =
+            llvm::ArrayType::get(llvm::Type::getInt32Ty(context_), 8);
+    compiler->sByteVector->createUnspecificReification().type =
+            llvm::ArrayType::get(llvm::Type::getInt8Ty(context_), 16);
 }
 
 LLVMTypeHelper::~LLVMTypeHelper() = default;
@@ -128,6 +134,30 @@ bool LLVMTypeHelper::isRemote(const Type &type) {
     return codeGenerator_->querySize(llvmTypeFor(type)) > kBoxSize;
 }
 
+Type LLVMTypeHelper::actualType(const Type &type) const {
+    if (reifiContext_ != nullptr && type.type() == TypeType::LocalGenericVariable &&
+            reifiContext_->providesActualTypeFor(type.genericVariableIndex())) {
+        return reifiContext_->actualType(type.genericVariableIndex());
+    }
+    return type;
+}
+
+bool LLVMTypeHelper::isTriviallyCopyable(const Type &type) const {
+    auto actual = actualType(type);
+    if (actual.isReference()) {
+        return true;
+    }
+    switch (actual.type()) {
+        case TypeType::GenericVariable:
+        case TypeType::LocalGenericVariable:
+            return false;  // Represented as box at run-time
+        case TypeType::Optional:
+            return isTriviallyCopyable(actual.optionalType());
+        default:
+            return !actual.isManaged();
+    }
+}
+
 llvm::Type* LLVMTypeHelper::llvmTypeFor(const Type &type) {
     if (reifiContext_ != nullptr && type.type() == TypeType::LocalGenericVariable &&
             reifiContext_->providesActualTypeFor(type.genericVariableIndex())) {
@@ -55,6 +55,14 @@ public:
     /// @returns True if this type cannot be directly stored in a box and memory must be allocated on the heap.
     bool isRemote(const Type &type);
 
+    /// @returns True if values of this type can be copied with memcpy, i.e. copying them requires no retain.
+    /// Local generic variables are resolved with the current reification context.
+    bool isTriviallyCopyable(const Type &type) const;
+
+    /// @returns The type the local generic variable @c type is reified with in the current reification context or
+    /// @c type itself if the context does not provide a type for it.
+    Type actualType(const Type &type) const;
+
     /// A pointer to a value of this type is stored in the first field of a box to identify its content.
     llvm::StructType* boxInfo() const { return boxInfoType_; }
     /// The class info stores the dispatch table as well as a pointer to the class info of the super class if this class
@@ -42,7 +42,13 @@ llvm::Value* StringPool::pool(const std::u32string &string) {
             codeGenerator_->declarator().ignoreBlockPtr(),
             compiler->sString->classInfo(),
             var,
-            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), utf8str.size())
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), utf8str.size()),
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), 0),
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), 0),
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), 0),
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), 0),
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), 0),
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(codeGenerator_->context()), 0)
     });
 
     auto stringVar = new llvm::GlobalVariable(*codeGenerator_->module(), stringLlvm, true,
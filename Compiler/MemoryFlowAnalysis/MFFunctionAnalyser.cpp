@@ -100,6 +100,9 @@ void MFFunctionAnalyser::releaseVariables(ASTBlock *block) {
 }
 
 void MFFunctionAnalyser::recordVariableGet(size_t id, MFFlowCategory category) {
+    if (collectedGets_ != nullptr) {
+        collectedGets_->push_back(id);
+    }
     if (category.isReturn()) {
         auto &var = scope_.getVariable(id);
         if (var.isParam) return;
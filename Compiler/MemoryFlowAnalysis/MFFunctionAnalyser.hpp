@@ -69,6 +69,10 @@ public:
     void recordThis(MFFlowCategory category);
     /// Records the flow category of the use of a variable value.
     void recordVariableGet(size_t id, MFFlowCategory category);
+    /// Until stopCollectingVariableGets() is called, the IDs of all variables passed to recordVariableGet() are
+    /// appended to @c ids.
+    void collectVariableGets(std::vector<size_t> *ids) { collectedGets_ = ids; }
+    void stopCollectingVariableGets() { collectedGets_ = nullptr; }
     /// Records an expression whose resulting value was assigned to a variable.
     /// If the compiler can prove that the variable value is never used in an Escaping manner it will inform the
     /// expression that it can allocate on the heap if it inherits from MFHeapAllocates.
@@ -101,6 +105,7 @@ private:
     IDScoper<MFLocalVariable> scope_;
     Function *function_;
     bool thisEscapes_ = false;
+    std::vector<size_t> *collectedGets_ = nullptr;
 
     void releaseVariables(ASTBlock *block);
 
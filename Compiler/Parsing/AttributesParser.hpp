@@ -26,6 +26,7 @@ enum class Attribute : char32_t {
     Deprecated = E_WARNING_SIGN, Final = E_LOCK_WITH_INK_PEN, Override = E_BLACK_NIB, StaticOnType = E_RABBIT,
     Required = E_KEY, Export = E_EARTH_GLOBE_EUROPE_AFRICA, Foreign = E_RADIO, Unsafe = E_BIOHAZARD,
     Mutating = E_CRAYON, Escaping = E_LEFT_LUGGAGE, Inline = E_BAGEL,
+    TailCall = E_CURLY_LOOP,
 };
 
 template <Attribute ...Attributes>
@@ -297,6 +297,8 @@ std::shared_ptr<ASTExpr> FunctionParser::parseExprIdentifier(const Token &token)
             return parseUnaryPrefix<ASTUnwrap>(token);
         case E_SCALES:
             return std::make_shared<ASTSizeOf>(parseType(), token.position());
+        case E_SOAP:
+            return std::make_shared<ASTIsTriviallyCopyable>(parseType(), token.position());
         case E_BLACK_SQUARE_BUTTON: {
             auto expr = parseExpr(kPrefixPrecedence);
             return std::make_shared<ASTCast>(expr, parseTypeExpr(token.position()), token.position());
@@ -98,7 +98,8 @@ void TypeBodyParser<TypeDef>::doParseMethod(const std::u32string &name, TypeBody
                                  const Documentation &documentation, AccessLevel access, Mood mood,
                                  const SourcePosition &p) {
     attributes.allow(Attribute::Deprecated).allow(Attribute::StaticOnType).allow(Attribute::Unsafe)
-            .allow(Attribute::Escaping).allow(Attribute::Inline).check(p, package_->compiler());
+            .allow(Attribute::Escaping).allow(Attribute::Inline).allow(Attribute::TailCall)
+            .check(p, package_->compiler());
 
     if (attributes.has(Attribute::StaticOnType)) {
         auto typeMethod = std::make_unique<Function>(name, access, attributes.has(Attribute::Final), typeDef_,
@@ -108,6 +109,9 @@ void TypeBodyParser<TypeDef>::doParseMethod(const std::u32string &name, TypeBody
                                                      std::is_same<TypeDef, Class>::value ?
                                                      FunctionType::ClassMethod : FunctionType::Function,
                                                      attributes.has(Attribute::Inline));
+        if (attributes.has(Attribute::TailCall)) {
+            typeMethod->setDemandsTailCalls();
+        }
         parseFunction(typeMethod.get(), false, attributes.has(Attribute::Escaping));
         typeDef_->addTypeMethod(std::move(typeMethod));
     }
@@ -119,6 +123,9 @@ void TypeBodyParser<TypeDef>::doParseMethod(const std::u32string &name, TypeBody
                                                  attributes.has(Attribute::Unsafe),
                                                  std::is_same<TypeDef, Class>::value ? FunctionType::ObjectMethod :
                                                  FunctionType::ValueTypeMethod, attributes.has(Attribute::Inline));
+        if (attributes.has(Attribute::TailCall)) {
+            method->setDemandsTailCalls();
+        }
         parseFunction(method.get(), false, attributes.has(Attribute::Escaping));
         typeDef_->addMethod(std::move(method));
     }
@@ -184,6 +184,11 @@ void ASTSizeOf::toCode(PrettyStream &pretty) const {
     pretty << "⚖️" << type_;
 }
 
+void ASTIsTriviallyCopyable::toCode(PrettyStream &pretty) const {
+    pretty.printComments(position());
+    pretty << "🧼" << type_;
+}
+
 void ASTCallableCall::toCode(PrettyStream &pretty) const {
     pretty.printComments(position());
     pretty << "⁉️" << callable_ << args_;
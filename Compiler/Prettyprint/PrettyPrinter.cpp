@@ -272,6 +272,9 @@ void PrettyPrinter::printFunctionAttributes(Function *function, bool noMutate) {
     if (function->isInline()) {
         prettyStream_ << "🥯 ";
     }
+    if (function->demandsTailCalls()) {
+        prettyStream_ << "➰ ";
+    }
     if (function->deprecated()) {
         prettyStream_ << "⚠️ ";
     }
@@ -55,8 +55,11 @@ public:
     Type typeForVariable(size_t n) {
         assert(offset_ <= n && n < offset_ + genericParameters_.size());
         Type type = Type(n, static_cast<T *>(this));
-        if (genericParameters_[n - offset_].useBox) {
-            type = type.boxedFor(constraintForIndex(n));
+        auto &parameter = genericParameters_[n - offset_];
+        if (parameter.useBox) {
+            // A constraint can refer to the variable it constrains, e.g. Key 🔖🐚Key🍆. While the constraint is
+            // analysed, the variable is boxed like a value of unknown type.
+            type = type.boxedFor(parameter.constraint->wasAnalysed() ? constraintForIndex(n) : Type::something());
         }
         return type;
     }
@@ -77,18 +80,23 @@ public:
         parameterVariables_.emplace(variableName, parameterVariables_.size());
     }
 
-    void requestReificationAndCheck(const TypeContext &typeContext, const std::vector<Type> &args,
-                                    const SourcePosition &p) {
+    /// Checks that @c args satisfy the constraints and requests a reification for them.
+    /// @param constraintContext The constraints are resolved on this context before they are checked. It must resolve
+    ///                          the generic variables of this instance to @c args, which allows a constraint to refer
+    ///                          to the generic parameters, e.g. T 😛🐚T🍆.
+    void requestReificationAndCheck(const TypeContext &typeContext, const TypeContext &constraintContext,
+                                    const std::vector<Type> &args, const SourcePosition &p) {
         if (args.size() - offset_ != genericParameters().size()) {
             throw CompilerError(p, "Expected ", genericParameters().size(), " generic arguments, but ",
                                 args.size(), " are provided.");
         }
 
         for (size_t i = offset_; i < args.size(); i++) {
-            if (!args[i].compatibleTo(constraintForIndex(i), typeContext)) {
+            auto constraint = constraintForIndex(i).resolveOn(constraintContext);
+            if (!args[i].compatibleTo(constraint, typeContext)) {
                 throw CompilerError(p, "Generic argument ", i + 1, " of type ",
                                     args[i].toString(typeContext), " is not compatible to constraint ",
-                                    constraintForIndex(offset_ + i).toString(typeContext), ".");
+                                    constraint.toString(typeContext), ".");
             }
         }
 
@@ -268,6 +268,8 @@ Type Type::resolveOn(const TypeContext &typeContext) const {
     }
     if (type() == TypeType::Box) {
         t.genericArguments_[0] = genericArguments_[0].resolveOn(typeContext).unboxed();
+        // The protocol the value is boxed for can have generic arguments, e.g. 🔖🐚Key🍆.
+        t.genericArguments_[1] = genericArguments_[1].resolveOn(typeContext).unboxed();
         return t;
     }
 
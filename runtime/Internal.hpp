@@ -30,4 +30,7 @@ struct Capture {
 
 }
 
+/// The control block of objects that are not reference counted, like string literals.
+extern runtime::internal::ControlBlock ejcIgnoreBlock;
+
 #endif //EMOJICODE_INTERNAL_HPP
@@ -64,6 +64,14 @@ class MemoryPointer {
     friend inline MemoryPointer<TA> allocate(int64_t n);
 public:
     MemoryPointer() {}
+
+    /// Creates a pointer to memory whose first word, at @c block, holds the control block and is followed by the
+    /// values. Use this to present memory that is not owned by a 🧠, like the inline buffer of an object, with a
+    /// control block that ignores retains and releases.
+    static MemoryPointer<T> atBlock(internal::ControlBlock **block) {
+        return MemoryPointer<T>(reinterpret_cast<int8_t *>(block));
+    }
+
     T* get() const {
         return reinterpret_cast<T*>(pointer_ + sizeof(runtime::internal::ControlBlock *));
     }
@@ -123,6 +123,25 @@ extern "C" void* ejcFindProtocolConformance(ProtocolConformanceEntry *info, void
     return nullptr;
 }
 
+/// The retain and release function of boxes whose values are not managed.
+extern "C" void ejcBoxManageNothing(int8_t *box) {}
+
+struct BoxInfo {
+    ProtocolConformanceEntry *protocolConformances;
+    void (*retain)(int8_t *box);
+    void (*release)(int8_t *box);
+};
+
+extern "C" bool ejcBoxesAreTriviallyCopyable(int8_t *boxes, runtime::Integer count, runtime::Integer boxSize) {
+    for (runtime::Integer i = 0; i < count; i++) {
+        auto info = *reinterpret_cast<BoxInfo **>(boxes + i * boxSize);
+        if (info != nullptr && info->retain != ejcBoxManageNothing) {
+            return false;
+        }
+    }
+    return true;
+}
+
 extern "C" void ejcMemoryRealloc(int8_t **pointerPtr, runtime::Integer newSize) {
     *pointerPtr = static_cast<int8_t*>(realloc(*pointerPtr, newSize + sizeof(runtime::internal::ControlBlock*)));
 }
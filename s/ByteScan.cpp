@@ -0,0 +1,251 @@
+//
+//  ByteScan.cpp
+//  EmojicodeCompiler
+//
+
+#include "../runtime/Runtime.h"
+#include "ByteScan.h"
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__)
+#define EJC_SCAN_X86
+#include <immintrin.h>
+#endif
+
+namespace s {
+
+namespace {
+
+using FindFunction = const char* (*)(const char *, size_t, const char *, size_t);
+using AsciiPrefixFunction = size_t (*)(const char *, size_t);
+
+/// The kernels used on this CPU. They are selected once by kernels().
+struct Kernels {
+    FindFunction find;
+    AsciiPrefixFunction asciiPrefix;
+};
+
+/// Compares the bytes between the first and the last byte of a candidate, which are already known to match.
+inline bool matchesInner(const char *candidate, const char *needle, size_t needleLength) {
+    return needleLength <= 2 || std::memcmp(candidate + 1, needle + 1, needleLength - 2) == 0;
+}
+
+// All find kernels require needleLength >= 2 and length >= needleLength.
+
+const char* findScalar(const char *haystack, size_t length, const char *needle, size_t needleLength) {
+    auto last = haystack + (length - needleLength);
+    for (auto p = haystack; p <= last; p++) {
+        p = static_cast<const char *>(std::memchr(p, needle[0], last - p + 1));
+        if (p == nullptr) {
+            return nullptr;
+        }
+        if (p[needleLength - 1] == needle[needleLength - 1] && matchesInner(p, needle, needleLength)) {
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+size_t asciiPrefixScalar(const char *bytes, size_t length) {
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        if ((word & UINT64_C(0x8080808080808080)) != 0) {
+            break;
+        }
+    }
+    while (i < length && (bytes[i] & 0x80) == 0) {
+        i++;
+    }
+    return i;
+}
+
+#ifdef EJC_SCAN_X86
+
+// The find kernels compare the first and the last byte of the needle against a whole block of candidates at once
+// and only run memcmp for candidates where both match.
+
+const char* findSse2(const char *haystack, size_t length, const char *needle, size_t needleLength) {
+    auto first = _mm_set1_epi8(needle[0]);
+    auto last = _mm_set1_epi8(needle[needleLength - 1]);
+    size_t i = 0;
+    for (; i + needleLength - 1 + 16 <= length; i += 16) {
+        auto blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i));
+        auto blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i + needleLength - 1));
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first),
+                                                                           _mm_cmpeq_epi8(blockLast, last))));
+        for (; mask != 0; mask &= mask - 1) {
+            auto candidate = haystack + i + __builtin_ctz(mask);
+            if (matchesInner(candidate, needle, needleLength)) {
+                return candidate;
+            }
+        }
+    }
+    if (length - i < needleLength) {
+        return nullptr;
+    }
+    return findScalar(haystack + i, length - i, needle, needleLength);
+}
+
+__attribute__((target("avx2")))
+const char* findAvx2(const char *haystack, size_t length, const char *needle, size_t needleLength) {
+    auto first = _mm256_set1_epi8(needle[0]);
+    auto last = _mm256_set1_epi8(needle[needleLength - 1]);
+    size_t i = 0;
+    for (; i + needleLength - 1 + 32 <= length; i += 32) {
+        auto blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i));
+        auto blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i + needleLength - 1));
+        auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first),
+                                                                                 _mm256_cmpeq_epi8(blockLast, last))));
+        for (; mask != 0; mask &= mask - 1) {
+            auto candidate = haystack + i + __builtin_ctz(mask);
+            if (matchesInner(candidate, needle, needleLength)) {
+                return candidate;
+            }
+        }
+    }
+    if (length - i < needleLength) {
+        return nullptr;
+    }
+    return findSse2(haystack + i, length - i, needle, needleLength);
+}
+
+size_t asciiPrefixSse2(const char *bytes, size_t length) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        auto mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i)));
+        if (mask != 0) {
+            return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+    return i + asciiPrefixScalar(bytes + i, length - i);
+}
+
+__attribute__((target("avx2")))
+size_t asciiPrefixAvx2(const char *bytes, size_t length) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        auto mask = _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + i)));
+        if (mask != 0) {
+            return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+    return i + asciiPrefixSse2(bytes + i, length - i);
+}
+
+#endif
+
+Kernels selectKernels() {
+#ifdef EJC_SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Kernels{findAvx2, asciiPrefixAvx2};
+    }
+    // SSE2 is part of x86-64 and always available.
+    return Kernels{findSse2, asciiPrefixSse2};
+#else
+    return Kernels{findScalar, asciiPrefixScalar};
+#endif
+}
+
+const Kernels& kernels() {
+    static const Kernels kernels = selectKernels();
+    return kernels;
+}
+
+}  // namespace
+
+const char* findBytes(const char *haystack, size_t length, const char *needle, size_t needleLength) {
+    if (needleLength == 0) {
+        return haystack;
+    }
+    if (needleLength > length) {
+        return nullptr;
+    }
+    if (needleLength == 1) {
+        return static_cast<const char *>(std::memchr(haystack, needle[0], length));
+    }
+    return kernels().find(haystack, length, needle, needleLength);
+}
+
+size_t asciiPrefixLength(const char *bytes, size_t length) {
+    return kernels().asciiPrefix(bytes, length);
+}
+
+bool isValidUtf8(const char *bytes, size_t length) {
+    auto asciiPrefix = kernels().asciiPrefix;
+    auto units = reinterpret_cast<const unsigned char *>(bytes);
+    size_t i = 0;
+    while (true) {
+        i += asciiPrefix(bytes + i, length - i);
+        if (i == length) {
+            return true;
+        }
+
+        // Decode one multi-byte sequence. The range of the second byte is restricted for some lead bytes to
+        // reject overlong encodings, surrogates and code points beyond U+10FFFF.
+        auto lead = units[i];
+        size_t continuations;
+        unsigned char low = 0x80, high = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            continuations = 1;
+        }
+        else if (lead == 0xE0) {
+            continuations = 2;
+            low = 0xA0;
+        }
+        else if (lead == 0xED) {
+            continuations = 2;
+            high = 0x9F;
+        }
+        else if (lead >= 0xE1 && lead <= 0xEF) {
+            continuations = 2;
+        }
+        else if (lead == 0xF0) {
+            continuations = 3;
+            low = 0x90;
+        }
+        else if (lead >= 0xF1 && lead <= 0xF3) {
+            continuations = 3;
+        }
+        else if (lead == 0xF4) {
+            continuations = 3;
+            high = 0x8F;
+        }
+        else {
+            return false;
+        }
+
+        if (length - i <= continuations || units[i + 1] < low || units[i + 1] > high) {
+            return false;
+        }
+        for (size_t j = 2; j <= continuations; j++) {
+            if ((units[i + j] & 0xC0) != 0x80) {
+                return false;
+            }
+        }
+        i += continuations + 1;
+    }
+}
+
+uint32_t matchByteGroup(const char *group, char byte) {
+#ifdef EJC_SCAN_X86
+    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(byte))));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 16; i++) {
+        mask |= static_cast<uint32_t>(group[i] == byte) << i;
+    }
+    return mask;
+#endif
+}
+
+}  // namespace s
+
+extern "C" runtime::Integer sMemoryMatchByteGroup(int8_t **memory, runtime::Integer offset, runtime::Byte byte) {
+    return s::matchByteGroup(reinterpret_cast<const char *>(*memory + sizeof(runtime::internal::ControlBlock *)) +
+                             offset, byte);
+}
@@ -0,0 +1,32 @@
+//
+//  ByteScan.h
+//  EmojicodeCompiler
+//
+
+#ifndef EMOJICODE_BYTESCAN_H
+#define EMOJICODE_BYTESCAN_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace s {
+
+/// Searches the first occurrence of the @c needleLength bytes at @c needle in the @c length bytes at @c haystack.
+/// @returns A pointer to the first byte of the occurrence or @c nullptr if @c needle does not occur.
+/// An empty needle is found at @c haystack.
+/// @note The implementation is selected once at runtime depending on the vector extensions the CPU supports.
+const char* findBytes(const char *haystack, size_t length, const char *needle, size_t needleLength);
+
+/// @returns The number of bytes at the beginning of the @c length bytes at @c bytes that are ASCII characters.
+size_t asciiPrefixLength(const char *bytes, size_t length);
+
+/// @returns True iff the @c length bytes at @c bytes are a well-formed UTF-8 sequence. Overlong encodings,
+/// surrogates and code points beyond U+10FFFF are rejected.
+bool isValidUtf8(const char *bytes, size_t length);
+
+/// @returns A mask in which bit @c i is set iff the byte at @c group + @c i equals @c byte, for @c i < 16.
+uint32_t matchByteGroup(const char *group, char byte);
+
+}  // namespace s
+
+#endif //EMOJICODE_BYTESCAN_H
@@ -3,10 +3,10 @@
 //
 
 #include "../runtime/Runtime.h"
+#include "ByteScan.h"
 #include "Data.h"
+#include "Hash.h"
 #include "String.h"
-#include "utf8proc.h"
-#include <algorithm>
 
 namespace s {
 
@@ -15,24 +15,31 @@ extern "C" runtime::SimpleOptional<runtime::Integer> sDataFindFromIndex(Data *da
     if (offset >= data->count) {
         return runtime::NoValue;
     }
-    auto end = data->data.get() + data->count;
-    auto pos = std::search(data->data.get() + offset, end, search->data.get(), search->data.get() + search->count);
-    if (pos != end) {
+    auto pos = findBytes(data->data.get() + offset, data->count - offset, search->data.get(), search->count);
+    if (pos != nullptr) {
         return pos - data->data.get();
     }
     return runtime::NoValue;
 }
 
 extern "C" runtime::SimpleOptional<String *> sDataAsString(Data *data) {
-    auto chars = reinterpret_cast<char *>(data->data.get());
-
-    // TODO: validate
+    if (!isValidUtf8(data->data.get(), data->count)) {
+        return runtime::NoValue;
+    }
 
     auto *string = String::init();
+    if (data->count <= String::kSmallCapacity) {
+        string->store(reinterpret_cast<const char *>(data->data.get()), data->count);
+        return string;
+    }
     string->count = data->count;
     string->characters = data->data;
     data->data.retain();
     return string;
 }
 
+extern "C" runtime::Integer sDataHash(Data *data) {
+    return hashBytes(data->data.get(), data->count);
+}
+
 }  // namespace s
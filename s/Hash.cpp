@@ -0,0 +1,112 @@
+//
+//  Hash.cpp
+//  EmojicodeCompiler
+//
+
+#include "Hash.h"
+#include "../runtime/Internal.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace s {
+
+namespace {
+
+// This is wyhash (final version 4) by Wang Yi, which is in the public domain.
+
+__extension__ typedef unsigned __int128 UInt128;
+
+const uint64_t kSecret[] = {
+    UINT64_C(0x2d358dccaa6c78a5), UINT64_C(0x8bb84b93962eacc9),
+    UINT64_C(0x4b33a62ed433d4a3), UINT64_C(0x4d5a2da51de1aa47),
+};
+
+/// Multiplies @c a and @c b and stores the lower half of the product in @c a and the upper half in @c b.
+inline void multiply(uint64_t &a, uint64_t &b) {
+    auto product = static_cast<UInt128>(a) * b;
+    a = static_cast<uint64_t>(product);
+    b = static_cast<uint64_t>(product >> 64);
+}
+
+inline uint64_t mix(uint64_t a, uint64_t b) {
+    multiply(a, b);
+    return a ^ b;
+}
+
+inline uint64_t read8(const uint8_t *p) {
+    uint64_t value;
+    std::memcpy(&value, p, 8);
+    return value;
+}
+
+inline uint64_t read4(const uint8_t *p) {
+    uint32_t value;
+    std::memcpy(&value, p, 4);
+    return value;
+}
+
+/// Reads the first, the middle and the last of the @c length bytes, where 0 < @c length < 4.
+inline uint64_t read3(const uint8_t *p, size_t length) {
+    return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+}
+
+uint64_t wyhash(const uint8_t *p, size_t length, uint64_t seed) {
+    seed ^= mix(seed ^ kSecret[0], kSecret[1]);
+    uint64_t a, b;
+    if (length <= 16) {
+        if (length >= 4) {
+            // Two possibly overlapping reads from each end cover all bytes.
+            auto shift = (length >> 3) << 2;
+            a = (read4(p) << 32) | read4(p + shift);
+            b = (read4(p + length - 4) << 32) | read4(p + length - 4 - shift);
+        }
+        else if (length > 0) {
+            a = read3(p, length);
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        auto i = length;
+        if (i > 48) {
+            // Three independent lanes keep the multipliers busy.
+            auto seed1 = seed, seed2 = seed;
+            do {
+                seed = mix(read8(p) ^ kSecret[1], read8(p + 8) ^ seed);
+                seed1 = mix(read8(p + 16) ^ kSecret[2], read8(p + 24) ^ seed1);
+                seed2 = mix(read8(p + 32) ^ kSecret[3], read8(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16) {
+            seed = mix(read8(p) ^ kSecret[1], read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = read8(p + i - 16);
+        b = read8(p + i - 8);
+    }
+    a ^= kSecret[1];
+    b ^= seed;
+    multiply(a, b);
+    return mix(a ^ kSecret[0] ^ length, b ^ kSecret[1]);
+}
+
+}  // namespace
+
+runtime::Integer hashBytes(const void *bytes, size_t length) {
+    auto hash = wyhash(static_cast<const uint8_t *>(bytes), length, static_cast<uint64_t>(runtime::internal::seed));
+    // The sign bit is left clear for 📌, which uses it to mark interned strings.
+    return static_cast<runtime::Integer>(hash >> 1);
+}
+
+runtime::Integer hashInteger(runtime::Integer value) {
+    auto seed = static_cast<uint64_t>(runtime::internal::seed);
+    return static_cast<runtime::Integer>(mix(static_cast<uint64_t>(value) ^ seed ^ kSecret[0], kSecret[1]) >> 1);
+}
+
+}  // namespace s
@@ -0,0 +1,24 @@
+//
+//  Hash.h
+//  EmojicodeCompiler
+//
+
+#ifndef EMOJICODE_HASH_H
+#define EMOJICODE_HASH_H
+
+#include "../runtime/Runtime.h"
+#include <cstddef>
+
+namespace s {
+
+/// Hashes the @c length bytes at @c bytes with wyhash, seeded with the seed of this process.
+/// @returns A non-negative hash. Equal byte sequences have equal hashes within a process.
+runtime::Integer hashBytes(const void *bytes, size_t length);
+
+/// Hashes @c value by multiplying it with a constant and folding the product, seeded with the seed of this process.
+/// @returns A non-negative hash.
+runtime::Integer hashInteger(runtime::Integer value);
+
+}  // namespace s
+
+#endif //EMOJICODE_HASH_H
@@ -7,81 +7,212 @@
 //
 
 #include "../runtime/Runtime.h"
+#include "Hash.h"
 #include "String.h"
 #include <cstdint>
 #include <cstdlib>
-#include <cmath>
+#include <cstring>
+#include <limits>
 
 using s::String;
 
-extern "C" runtime::Integer sIntAbsolute(runtime::Integer *integer) {
-    return std::abs(*integer);
+namespace {
+
+const char kDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+/// The two ASCII digits of every number below 100.
+const char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+const uint64_t kPowersOfTen[] = {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000),
+    UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000),
+    UINT64_C(100000000000), UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000),
+    UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000), UINT64_C(10000000000000000000),
+};
+
+/// Returns the absolute value of @c n. Unlike std::abs this is defined for the smallest integer.
+uint64_t magnitude(runtime::Integer n) {
+    return n < 0 ? 0 - static_cast<uint64_t>(n) : static_cast<uint64_t>(n);
 }
 
-extern "C" s::String* sIntToString(runtime::Integer *nptr, runtime::Integer base) {
-    auto n = *nptr;
-    auto a = std::abs(n);
-    bool negative = n < 0;
+int decimalDigitCount(uint64_t value) {
+    // 1233 / 4096 approximates log10(2), which turns the bit length into a guess that is at most one too small.
+    auto guess = ((64 - __builtin_clzll(value | 1)) * 1233) >> 12;
+    return guess + ((value | 1) >= kPowersOfTen[guess]);
+}
 
-    unsigned int d = negative ? 2 : 1;
-    while ((n /= base) != 0) {
-        d++;
+/// Writes the decimal digits of @c value so that the last one ends up right before @c end.
+void formatDecimal(uint64_t value, char *end) {
+    while (value >= 100) {
+        auto pair = value % 100;
+        value /= 100;
+        end -= 2;
+        std::memcpy(end, kDigitPairs + pair * 2, 2);
+    }
+    if (value >= 10) {
+        std::memcpy(end - 2, kDigitPairs + value * 2, 2);
     }
+    else {
+        end[-1] = static_cast<char>('0' + value);
+    }
+}
 
-    auto string = String::init();
-    string->count = d;
-    string->characters = runtime::allocate<char>(d);
+bool isDecimalDigit(char c) {
+    return '0' <= c && c <= '9';
+}
 
-    auto *characters = string->characters.get() + d;
-    do {
-        *--characters =  "0123456789abcdefghijklmnopqrstuvxyz"[a % base % 35];
-    } while ((a /= base) > 0);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define EJC_SWAR_DIGITS
 
-    if (negative) {
-        characters[-1] = '-';
-    }
-    return string;
+/// Whether all eight bytes of @c chunk are ASCII digits. Adding 6 carries exactly the bytes above '9' into the
+/// upper nibble.
+bool isEightDigits(uint64_t chunk) {
+    return ((chunk & UINT64_C(0xF0F0F0F0F0F0F0F0)) |
+            (((chunk + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4)) ==
+        UINT64_C(0x3333333333333333);
 }
 
-extern "C" s::String* sRealToString(runtime::Real *real, runtime::Integer precision) {
-    double integral;
-    double fractional = std::modf(*real, &integral);
+/// Returns the value of the eight ASCII digits in @c chunk, the first digit being in the lowest byte.
+/// Adjacent digits are combined into pairs, pairs into quadruples and quadruples into the result.
+uint64_t parseEightDigits(uint64_t chunk) {
+    chunk -= UINT64_C(0x3030303030303030);
+    chunk = (chunk * 10) + (chunk >> 8);
+    return (((chunk & UINT64_C(0x000000FF000000FF)) * UINT64_C(0x000F424000000064)) +
+            (((chunk >> 16) & UINT64_C(0x000000FF000000FF)) * UINT64_C(0x0000271000000001))) >> 32;
+}
 
-    if (precision <= 0) {
-        runtime::Integer i = static_cast<runtime::Integer>(integral);
-        return sIntToString(&i, 10);
+#endif
+
+/// Parses the decimal digits in [@c p, @c end) into @c value. Returns false if a byte is not a digit or the value
+/// exceeds @c limit.
+bool parseDecimal(const char *p, const char *end, uint64_t limit, uint64_t &value) {
+#ifdef EJC_SWAR_DIGITS
+    for (; end - p >= 8; p += 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, p, 8);
+        if (!isEightDigits(chunk)) {
+            return false;
+        }
+        if (__builtin_mul_overflow(value, UINT64_C(100000000), &value) ||
+            __builtin_add_overflow(value, parseEightDigits(chunk), &value)) {
+            return false;
+        }
     }
+#endif
+    for (; p < end; p++) {
+        if (!isDecimalDigit(*p) || __builtin_mul_overflow(value, UINT64_C(10), &value) ||
+            __builtin_add_overflow(value, static_cast<uint64_t>(*p - '0'), &value)) {
+            return false;
+        }
+    }
+    return value <= limit;
+}
 
-    auto a = std::abs(static_cast<long long>(integral));
-    bool negative = integral < 0;
-
-    unsigned int d = (negative ? 3 : 2) + precision;
-    auto ac = a;
-    while ((ac /= 10) != 0) {
-        d++;
+/// Parses the digits in [@c p, @c end) in @c base into @c value. Letters are accepted in either case.
+bool parseDigits(const char *p, const char *end, uint64_t base, uint64_t limit, uint64_t &value) {
+    for (; p < end; p++) {
+        auto c = *p;
+        auto digit = base;
+        if (isDecimalDigit(c)) {
+            digit = c - '0';
+        }
+        else if ('A' <= c && c <= 'Z') {
+            digit = c - 'A' + 10;
+        }
+        else if ('a' <= c && c <= 'z') {
+            digit = c - 'a' + 10;
+        }
+
+        if (digit >= base || __builtin_mul_overflow(value, base, &value) ||
+            __builtin_add_overflow(value, digit, &value)) {
+            return false;
+        }
     }
+    return value <= limit;
+}
 
-    auto string = String::init();
-    string->count = d;
-    string->characters = runtime::allocate<char>(d);
+}  // namespace
 
-    auto *characters = string->characters.get() + d;
+runtime::Integer s::formattedIntegerLength(runtime::Integer n, runtime::Integer base) {
+    runtime::Integer d = n < 0 ? 1 : 0;
+    auto a = magnitude(n);
+    if (base == 10) {
+        return d + decimalDigitCount(a);
+    }
+    do {
+        d++;
+    } while ((a /= base) != 0);
+    return d;
+}
 
-    auto f = static_cast<long long>(std::abs(std::pow(10, precision) * fractional));
-    for (decltype(precision) i = 0; i < precision; i++) {
-        *--characters = "0123456789"[f % 10];
-        f /= 10;
+void s::formatInteger(runtime::Integer n, runtime::Integer base, char *buffer) {
+    auto a = magnitude(n);
+    auto *end = buffer + formattedIntegerLength(n, base);
+    if (n < 0) {
+        buffer[0] = '-';
+    }
+    if (base == 10) {
+        formatDecimal(a, end);
+        return;
     }
-    *--characters = '.';
     do {
-        *--characters = "0123456789"[a % 10];
-    } while ((a /= 10) > 0);
-    if (negative) {
-        characters[-1] = '-';
+        *--end = kDigits[a % base];
+    } while ((a /= base) > 0);
+}
+
+runtime::SimpleOptional<runtime::Integer> s::parseInteger(const char *characters, runtime::Integer length,
+                                                          runtime::Integer base) {
+    auto p = characters, end = characters + length;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
     }
+    if (p == end) {
+        return runtime::NoValue;
+    }
+
+    auto limit = static_cast<uint64_t>(std::numeric_limits<runtime::Integer>::max()) + (negative ? 1 : 0);
+    uint64_t value = 0;
+    auto valid = base == 10 ? parseDecimal(p, end, limit, value) : parseDigits(p, end, base, limit, value);
+    if (!valid) {
+        return runtime::NoValue;
+    }
+    return static_cast<runtime::Integer>(negative ? 0 - value : value);
+}
+
+extern "C" runtime::Integer sIntAbsolute(runtime::Integer *integer) {
+    return std::abs(*integer);
+}
+
+extern "C" s::String* sIntToString(runtime::Integer *nptr, runtime::Integer base) {
+    auto string = String::init();
+    s::formatInteger(*nptr, base, string->allocate(s::formattedIntegerLength(*nptr, base)));
     return string;
 }
 
+extern "C" runtime::Integer sIntFormattedLength(runtime::Integer *n, runtime::Integer base) {
+    return s::formattedIntegerLength(*n, base);
+}
+
+extern "C" runtime::Integer sIntWriteToMemory(runtime::Integer *n, runtime::MemoryPointer<char> destination,
+                                              runtime::Integer offset, runtime::Integer base) {
+    s::formatInteger(*n, base, destination.get() + offset);
+    return s::formattedIntegerLength(*n, base);
+}
+
+extern "C" runtime::Integer sIntHash(runtime::Integer *integer) {
+    return s::hashInteger(*integer);
+}
+
+extern "C" runtime::Integer sIntTrailingZeros(runtime::Integer *integer) {
+    return *integer == 0 ? 64 : __builtin_ctzll(static_cast<uint64_t>(*integer));
+}
+
 extern "C" runtime::Byte sIntToByte(runtime::Integer *integer) {
     return static_cast<runtime::Byte>(*integer);
 }
@@ -0,0 +1,84 @@
+//
+//  Intern.cpp
+//  EmojicodeCompiler
+//
+
+#include "../runtime/Runtime.h"
+#include "../runtime/Internal.hpp"
+#include "String.h"
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <unordered_set>
+
+namespace s {
+
+namespace {
+
+struct StringHash {
+    size_t operator()(String *string) const { return static_cast<size_t>(string->loadHash()); }
+};
+
+struct StringEqual {
+    bool operator()(String *a, String *b) const {
+        return a->count == b->count && std::memcmp(a->bytes(), b->bytes(), a->count) == 0;
+    }
+};
+
+/// The intern table is split into shards, each guarded by its own mutex, so that threads interning different
+/// strings rarely contend.
+struct Shard {
+    std::mutex mutex;
+    std::unordered_set<String *, StringHash, StringEqual> strings;
+};
+
+constexpr size_t kShardCount = 16;
+Shard shards[kShardCount];
+
+/// Whether @c string can be kept in the table. Literals are shared already, local objects die with their stack frame
+/// and slices would keep their whole parent buffer alive.
+bool canShare(String *string) {
+    auto controlBlock = string->controlBlock();
+    return controlBlock != nullptr && controlBlock != &ejcIgnoreBlock && string->offset == 0;
+}
+
+String* copy(String *string) {
+    auto copy = String::init();
+    copy->store(string->bytes(), string->count);
+    return copy;
+}
+
+}  // namespace
+
+String* intern(String *string) {
+    if (string->isInterned()) {
+        return string;
+    }
+    auto hash = string->loadHash();
+    auto &shard = shards[static_cast<size_t>(hash) % kShardCount];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.strings.find(string);
+    if (it != shard.strings.end()) {
+        return *it;
+    }
+
+    String *representative;
+    if (canShare(string)) {
+        representative = string;
+        representative->retain();
+    }
+    else {
+        representative = copy(string);
+    }
+    representative->hash.store(hash | std::numeric_limits<runtime::Integer>::min(), std::memory_order_relaxed);
+    shard.strings.insert(representative);
+    return representative;
+}
+
+extern "C" String* sStringIntern(String *string) {
+    auto interned = intern(string);
+    interned->retain();
+    return interned;
+}
+
+}  // namespace s
@@ -0,0 +1,13 @@
+//
+//  Memory.cpp
+//  EmojicodeCompiler
+//
+
+#include "../runtime/Runtime.h"
+
+extern "C" bool ejcIsOnlyReference(runtime::Object<void> *object);
+
+extern "C" bool sMemoryIsOnlyReference(int8_t **memory, runtime::Integer offset) {
+    auto slot = *memory + sizeof(runtime::internal::ControlBlock *) + offset;
+    return ejcIsOnlyReference(*reinterpret_cast<runtime::Object<void> **>(slot));
+}
@@ -6,9 +6,92 @@
 //  Copyright © 2017 Theo Weidmann. All rights reserved.
 //
 
+#include "../runtime/Runtime.h"
+#include "../Compiler/Utils/rapidjson/rapidjson.h"
+#include "../Compiler/Utils/rapidjson/internal/dtoa.h"
+#include "String.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+
+using s::String;
+
+namespace {
+
+/// The shortest decimal digits that identify a finite double, as found by Grisu2. The absolute value of the double is
+/// 0.digits × 10^point.
+struct ShortestDigits {
+    explicit ShortestDigits(double value) {
+        if (value == 0) {
+            digits[0] = '0';
+            length = 1;
+            point = 1;
+            return;
+        }
+        int k;
+        rapidjson::internal::Grisu2(std::abs(value), digits, &length, &k);
+        point = length + k;
+    }
+
+    char digit(int index) const { return 0 <= index && index < length ? digits[index] : '0'; }
+
+    char digits[25];
+    int length;
+    /// The number of digits before the decimal point. Negative if there are zeros after the decimal point.
+    int point;
+};
+
+const char* nonFiniteText(double value) {
+    if (std::isnan(value)) {
+        return "nan";
+    }
+    return value < 0 ? "-inf" : "inf";
+}
+
+/// Whether a minus sign is written. Without decimal places the number is truncated to an integer, which is not
+/// negative if it is zero.
+bool isNegative(double value, const ShortestDigits &decimal, runtime::Integer precision) {
+    return value < 0 && (precision > 0 || decimal.point > 0);
+}
+
+}  // namespace
+
+runtime::Integer s::formattedRealLength(runtime::Real real, runtime::Integer precision) {
+    if (!std::isfinite(real)) {
+        return std::strlen(nonFiniteText(real));
+    }
+    ShortestDigits decimal(real);
+    auto length = (isNegative(real, decimal, precision) ? 1 : 0) + std::max(decimal.point, 1);
+    return precision > 0 ? length + 1 + precision : length;
+}
+
+void s::formatReal(runtime::Real real, runtime::Integer precision, char *buffer) {
+    if (!std::isfinite(real)) {
+        auto text = nonFiniteText(real);
+        std::memcpy(buffer, text, std::strlen(text));
+        return;
+    }
+
+    ShortestDigits decimal(real);
+    if (isNegative(real, decimal, precision)) {
+        *buffer++ = '-';
+    }
+    if (decimal.point <= 0) {
+        *buffer++ = '0';
+    }
+    for (int i = 0; i < decimal.point; i++) {
+        *buffer++ = decimal.digit(i);
+    }
+    if (precision <= 0) {
+        return;
+    }
+    *buffer++ = '.';
+    for (runtime::Integer i = 0; i < precision; i++) {
+        *buffer++ = decimal.digit(static_cast<int>(decimal.point + i));
+    }
+}
 
 extern "C" double sRealAbsolute(double *real) {
     return std::abs(*real);
@@ -65,3 +148,20 @@ extern "C" double sRealLog2(double *real) {
 extern "C" double sRealLn(double *real) {
     return std::log(*real);
 }
+
+extern "C" String* sRealToString(runtime::Real *real, runtime::Integer precision) {
+    auto string = String::init();
+    s::formatReal(*real, precision, string->allocate(s::formattedRealLength(*real, precision)));
+    return string;
+}
+
+extern "C" String* sRealToShortestString(runtime::Real *real) {
+    if (!std::isfinite(*real)) {
+        return String::init(nonFiniteText(*real));
+    }
+    char buffer[32];
+    auto end = rapidjson::internal::dtoa(*real, buffer);
+    auto string = String::init();
+    string->store(buffer, end - buffer);
+    return string;
+}
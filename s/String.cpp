@@ -8,7 +8,11 @@
 
 #include "../runtime/Runtime.h"
 #include "../runtime/Internal.hpp"
+#include "../Compiler/Utils/rapidjson/rapidjson.h"
+#include "../Compiler/Utils/rapidjson/internal/strtod.h"
+#include "ByteScan.h"
 #include "Data.h"
+#include "Hash.h"
 #include "String.h"
 #include "utf8proc.h"
 #include <algorithm>
@@ -17,11 +21,246 @@
 #include <cmath>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 using s::String;
 
 std::string String::stdString() {
-    return std::string(characters.get(), count);
+    return std::string(bytes(), count);
+}
+
+String* String::slice(String *parent, runtime::Integer from, runtime::Integer count) {
+    auto string = String::init();
+    if (count <= kSmallCapacity) {
+        std::memcpy(string->allocate(count), parent->bytes() + from, count);
+        return string;
+    }
+    string->characters = parent->characters;
+    string->characters.retain();
+    string->offset = parent->offset + from;
+    string->count = count;
+    return string;
+}
+
+int String::compare(String *other) {
+    if (this == other) {
+        return 0;
+    }
+    if (count != other->count) {
+        return count < other->count ? -1 : 1;
+    }
+    return std::memcmp(bytes(), other->bytes(), count);
+}
+
+bool String::equals(String *other) {
+    if (this == other) {
+        return true;
+    }
+    // There is only one interned string per value.
+    if (count != other->count || (isInterned() && other->isInterned())) {
+        return false;
+    }
+    auto hash = this->hash.load(std::memory_order_relaxed), otherHash = other->hash.load(std::memory_order_relaxed);
+    // Different hashes mean different values. The interned mark is ignored.
+    if (hash != 0 && otherHash != 0 && ((hash ^ otherHash) & std::numeric_limits<runtime::Integer>::max()) != 0) {
+        return false;
+    }
+    return std::memcmp(bytes(), other->bytes(), count) == 0;
+}
+
+runtime::Integer String::loadHash() {
+    auto cached = hash.load(std::memory_order_relaxed);
+    if (cached != 0) {
+        return cached & std::numeric_limits<runtime::Integer>::max();
+    }
+    auto computed = s::hashBytes(bytes(), count);
+    // String literals are constants, which cannot store the hash. A concurrent intern() might have set the mark.
+    if (controlBlock() != &ejcIgnoreBlock) {
+        hash.compare_exchange_strong(cached, computed, std::memory_order_relaxed);
+    }
+    return computed;
+}
+
+namespace s {
+
+/// Walks the grapheme boundaries of a string.
+class GraphemeCursor {
+public:
+    /// Creates a cursor at the grapheme starting at byte @c offset. @c state must be the break state
+    /// utf8proc_grapheme_break_stateful() reported for the boundary at @c offset, or 0 at the beginning of the string.
+    GraphemeCursor(String *string, runtime::Integer offset, utf8proc_int32_t state)
+            : bytes_(reinterpret_cast<utf8proc_uint8_t *>(string->bytes())), count_(string->count),
+              offset_(offset), next_(offset), state_(state) {
+        if (offset_ < count_) {
+            next_ += decode(next_, &previous_);
+        }
+    }
+
+    /// The byte offset at which the current grapheme begins.
+    runtime::Integer offset() const { return offset_; }
+    utf8proc_int32_t state() const { return state_; }
+    /// Whether the cursor has moved past the last grapheme.
+    bool atEnd() const { return offset_ >= count_; }
+
+    /// Moves the cursor to the beginning of the next grapheme.
+    void advance() {
+        while (next_ < count_) {
+            if (previous_ < 0x80 && bytes_[next_] < 0x80) {
+                auto begin = next_++;
+                auto isBreak = previous_ != '\r' || bytes_[begin] != '\n';
+                previous_ = bytes_[begin];
+                state_ = asciiBoundClass(previous_);
+                if (isBreak) {
+                    offset_ = begin;
+                    return;
+                }
+                continue;
+            }
+            utf8proc_int32_t codepoint;
+            auto begin = next_;
+            next_ += decode(next_, &codepoint);
+            auto isBreak = utf8proc_grapheme_break_stateful(previous_, codepoint, &state_);
+            previous_ = codepoint;
+            if (isBreak) {
+                offset_ = begin;
+                return;
+            }
+        }
+        offset_ = count_;
+    }
+
+    /// Moves the cursor @c n graphemes forward or until it is at the end.
+    /// @returns The number of graphemes the cursor moved.
+    runtime::Integer advance(runtime::Integer n) {
+        runtime::Integer advanced = 0;
+        while (advanced < n && !atEnd()) {
+            auto run = asciiRun(n - advanced);
+            if (run > 1) {
+                offset_ = next_ + run - 1;
+                previous_ = bytes_[offset_];
+                state_ = asciiBoundClass(previous_);
+                next_ = offset_ + 1;
+                advanced += run;
+            }
+            else {
+                advance();
+                advanced++;
+            }
+        }
+        return advanced;
+    }
+
+private:
+    /// Between two ASCII characters there is a grapheme break unless they are CR LF. This method returns the number
+    /// of boundaries, but at most @c limit, that can therefore be skipped without consulting utf8proc.
+    runtime::Integer asciiRun(runtime::Integer limit) const {
+        if (previous_ >= 0x80 || previous_ == '\r') {
+            return 0;
+        }
+        auto begin = reinterpret_cast<const char *>(bytes_ + next_);
+        auto length = s::asciiPrefixLength(begin, std::min(count_ - next_, limit));
+        if (auto cr = static_cast<const char *>(std::memchr(begin, '\r', length))) {
+            length = cr - begin + 1;
+        }
+        return length;
+    }
+
+    /// The bound class utf8proc assigns to the ASCII character @c c.
+    static utf8proc_int32_t asciiBoundClass(utf8proc_int32_t c) {
+        switch (c) {
+            case '\r': return UTF8PROC_BOUNDCLASS_CR;
+            case '\n': return UTF8PROC_BOUNDCLASS_LF;
+            default: return c < 0x20 || c == 0x7F ? UTF8PROC_BOUNDCLASS_CONTROL : UTF8PROC_BOUNDCLASS_OTHER;
+        }
+    }
+
+    runtime::Integer decode(runtime::Integer offset, utf8proc_int32_t *codepoint) const {
+        auto length = utf8proc_iterate(bytes_ + offset, count_ - offset, codepoint);
+        return length > 0 ? length : 1;
+    }
+
+    utf8proc_uint8_t *bytes_;
+    runtime::Integer count_;
+    runtime::Integer offset_;
+    runtime::Integer next_;
+    utf8proc_int32_t previous_ = 0;
+    utf8proc_int32_t state_;
+};
+
+/// Sparse index of the grapheme boundaries of a string. It stores a checkpoint for every kStride-th grapheme, from
+/// which a GraphemeCursor can resume.
+class GraphemeIndex {
+public:
+    static constexpr runtime::Integer kStride = 64;
+    /// Strings with fewer bytes are not indexed, scanning them is cheap enough.
+    static constexpr runtime::Integer kMinimumBytes = 256;
+
+    explicit GraphemeIndex(String *string) {
+        GraphemeCursor cursor(string, 0, 0);
+        for (count_ = 0; !cursor.atEnd(); count_ += cursor.advance(kStride)) {
+            checkpoints_.emplace_back(Checkpoint{cursor.offset(), cursor.state()});
+        }
+    }
+
+    /// The number of graphemes in the string.
+    runtime::Integer count() const { return count_; }
+
+    /// Returns a cursor at the grapheme with index @c grapheme, which must be at least 0 and less than count().
+    GraphemeCursor seek(String *string, runtime::Integer grapheme) const {
+        auto &checkpoint = checkpoints_[grapheme / kStride];
+        GraphemeCursor cursor(string, checkpoint.offset, checkpoint.state);
+        cursor.advance(grapheme % kStride);
+        return cursor;
+    }
+
+private:
+    struct Checkpoint {
+        runtime::Integer offset;
+        utf8proc_int32_t state;
+    };
+
+    std::vector<Checkpoint> checkpoints_;
+    runtime::Integer count_;
+};
+
+}  // namespace s
+
+using s::GraphemeCursor;
+using s::GraphemeIndex;
+
+GraphemeIndex* String::loadGraphemeIndex() {
+    // String literals are constants, which cannot store an index.
+    if (count < GraphemeIndex::kMinimumBytes || controlBlock() == &ejcIgnoreBlock) {
+        return nullptr;
+    }
+    auto index = graphemeIndex.load(std::memory_order_acquire);
+    if (index != nullptr) {
+        return index;
+    }
+    auto built = new GraphemeIndex(this);
+    if (graphemeIndex.compare_exchange_strong(index, built, std::memory_order_acq_rel)) {
+        return built;
+    }
+    delete built;  // Another thread was faster
+    return index;
+}
+
+/// Returns a cursor at the grapheme with index @c grapheme or at the end if @c string has fewer graphemes. A negative
+/// @c grapheme returns a cursor at the start.
+static GraphemeCursor seekGrapheme(String *string, runtime::Integer grapheme) {
+    if (grapheme <= 0) {
+        return GraphemeCursor(string, 0, 0);
+    }
+    if (auto index = string->loadGraphemeIndex()) {
+        if (grapheme >= index->count()) {
+            return GraphemeCursor(string, string->count, 0);
+        }
+        return index->seek(string, grapheme);
+    }
+    GraphemeCursor cursor(string, 0, 0);
+    cursor.advance(grapheme);
+    return cursor;
 }
 
 String::String(const char *cstring) {
@@ -29,17 +268,45 @@ String::String(const char *cstring) {
 }
 
 void String::store(const char *cstring) {
-    count = strlen(cstring);
-    characters = runtime::allocate<char>(count);
-    std::memcpy(characters.get(), cstring, count);
+    store(cstring, strlen(cstring));
+}
+
+void String::store(const char *bytes, runtime::Integer count) {
+    std::memcpy(allocate(count), bytes, count);
+}
+
+char* String::allocate(runtime::Integer count) {
+    this->count = count;
+    offset = 0;
+    graphemeIndex = nullptr;
+    hash = 0;
+    if (count <= kSmallCapacity) {
+        smallBlock = &ejcIgnoreBlock;
+        characters = runtime::MemoryPointer<char>::atBlock(&smallBlock);
+    }
+    else {
+        smallBlock = nullptr;
+        characters = runtime::allocate<char>(count);
+    }
+    return characters.get();
+}
+
+extern "C" String* sStringInitWithMemory(String *string, runtime::MemoryPointer<char> memory,
+                                         runtime::Integer count) {
+    string->store(memory.get(), count);
+    return string;
+}
+
+extern "C" String* sStringByteSlice(String *string, runtime::Integer from, runtime::Integer count) {
+    return String::slice(string, from, count);
 }
 
 extern "C" void sStringPrint(String *string) {
-    std::cout.write(string->characters.get(), string->count) << '\n';
+    std::cout.write(string->bytes(), string->count) << '\n';
 }
 
 extern "C" void sStringPrintNoLn(String *string) {
-    std::cout.write(string->characters.get(), string->count);
+    std::cout.write(string->bytes(), string->count);
 }
 
 extern "C" String* sStringReadLine(String *string) {
@@ -53,62 +320,94 @@ extern "C" char sStringBeginsWith(String *string, String *beginning) {
     if (string->count < beginning->count) {
         return false;
     }
-    return std::memcmp(string->characters.get(), beginning->characters.get(), beginning->count) == 0;
+    return std::memcmp(string->bytes(), beginning->bytes(), beginning->count) == 0;
 }
 
 extern "C" char sStringEndsWith(String *string, String *ending) {
     if (string->count < ending->count) {
         return false;
     }
-    return std::memcmp(string->characters.get() + (string->count - ending->count), ending->characters.get(),
+    return std::memcmp(string->bytes() + (string->count - ending->count), ending->bytes(),
                        ending->count) == 0;
 }
 
+extern "C" runtime::Integer sStringCompare(String *string, String *other) {
+    return string->compare(other);
+}
+
 extern "C" runtime::Integer sStringUtf8ByteCount(String *string) {
     return string->count;
 }
 
-extern "C" String* sStringToLowercase(String *string) {
-    auto newString = String::init();
-    newString->count = string->count;
-    newString->characters = runtime::allocate<char>(string->count);
+/// Maps every code point of the @c count bytes at @c source with @c mapCodepoint and writes the result to
+/// @c destination unless it is @c nullptr. ASCII runs are mapped without utf8proc by flipping the case bit of all
+/// characters between @c first and @c last. Bytes that are not valid UTF-8 are copied unchanged.
+/// @returns The number of bytes of the mapped string, which can differ from @c count.
+static runtime::Integer mapCase(const char *source, runtime::Integer count,
+                                utf8proc_int32_t (*mapCodepoint)(utf8proc_int32_t), char first, char last,
+                                char *destination) {
+    runtime::Integer off = 0, doff = 0;
+    while (off < count) {
+        auto end = off + static_cast<runtime::Integer>(s::asciiPrefixLength(source + off, count - off));
+        if (destination != nullptr) {
+            for (auto i = off; i < end; i++) {
+                auto c = source[i];
+                destination[doff + i - off] = static_cast<char>(c ^ ((first <= c && c <= last) << 5));
+            }
+        }
+        doff += end - off;
+        off = end;
+        if (off == count) {
+            break;
+        }
 
-    size_t doff = 0;
-    for (size_t off = 0; off < string->count;) {
         utf8proc_int32_t codepoint;
-        auto state = utf8proc_iterate(reinterpret_cast<utf8proc_uint8_t *>(string->characters.get()) + off,
-                                      string->count, &codepoint);
-        if (state < 0) break;
-        doff += utf8proc_encode_char(utf8proc_tolower(codepoint),
-                                     reinterpret_cast<utf8proc_uint8_t *>(newString->characters.get()) + doff);
+        auto state = utf8proc_iterate(reinterpret_cast<const utf8proc_uint8_t *>(source) + off, count - off,
+                                      &codepoint);
+        if (state < 0) {
+            if (destination != nullptr) {
+                destination[doff] = source[off];
+            }
+            doff++;
+            off++;
+            continue;
+        }
+        utf8proc_uint8_t encoded[4];
+        auto length = utf8proc_encode_char(mapCodepoint(codepoint), encoded);
+        if (destination != nullptr) {
+            std::memcpy(destination + doff, encoded, length);
+        }
+        doff += length;
         off += state;
     }
-    return newString;
+    return doff;
 }
 
-extern "C" String* sStringToUppercase(String *string) {
-    auto newString = String::init();
-    newString->count = string->count;
-    newString->characters = runtime::allocate<char>(string->count);
-
-    size_t doff = 0;
-    for (size_t off = 0; off < string->count;) {
-        utf8proc_int32_t codepoint;
-        auto state = utf8proc_iterate(reinterpret_cast<utf8proc_uint8_t *>(string->characters.get()) + off,
-                                      string->count, &codepoint);
-        if (state < 0) break;
-        doff += utf8proc_encode_char(utf8proc_toupper(codepoint),
-                                     reinterpret_cast<utf8proc_uint8_t *>(newString->characters.get()) + doff);
-        off += state;
+/// Returns a new string with every code point of @c string mapped as described by mapCase() above. Strings that are
+/// not pure ASCII are measured first because mapping a code point may change the length of its encoding.
+static String* mapCase(String *string, utf8proc_int32_t (*mapCodepoint)(utf8proc_int32_t), char first, char last) {
+    auto source = string->bytes();
+    auto count = string->count;
+    if (static_cast<runtime::Integer>(s::asciiPrefixLength(source, count)) != count) {
+        count = mapCase(source, count, mapCodepoint, first, last, nullptr);
     }
+    auto newString = String::init();
+    mapCase(source, string->count, mapCodepoint, first, last, newString->allocate(count));
     return newString;
 }
 
+extern "C" String* sStringToLowercase(String *string) {
+    return mapCase(string, utf8proc_tolower, 'A', 'Z');
+}
+
+extern "C" String* sStringToUppercase(String *string) {
+    return mapCase(string, utf8proc_toupper, 'a', 'z');
+}
+
 extern "C" runtime::SimpleOptional<runtime::Integer> sStringFind(String *string, String* search) {
-    auto end = string->characters.get() + string->count;
-    auto pos = std::search(string->characters.get(), end, search->characters.get(), search->characters.get() + search->count);
-    if (pos != end) {
-        return pos - string->characters.get();
+    auto pos = s::findBytes(string->bytes(), string->count, search->bytes(), search->count);
+    if (pos != nullptr) {
+        return pos - string->bytes();
     }
     return runtime::NoValue;
 }
@@ -118,11 +417,9 @@ extern "C" runtime::SimpleOptional<runtime::Integer> sStringFindFromIndex(String
     if (offset >= string->count) {
         return runtime::NoValue;
     }
-    auto end = string->characters.get() + string->count;
-    auto pos = std::search(string->characters.get() + offset, end, search->characters.get(),
-                           search->characters.get() + search->count);
-    if (pos != end) {
-        return pos - string->characters.get();
+    auto pos = s::findBytes(string->bytes() + offset, string->count - offset, search->bytes(), search->count);
+    if (pos != nullptr) {
+        return pos - string->bytes();
     }
     return runtime::NoValue;
 }
@@ -130,15 +427,21 @@ extern "C" runtime::SimpleOptional<runtime::Integer> sStringFindFromIndex(String
 extern "C" s::Data* sStringToData(String *string) {
     auto data = s::Data::init();
     data->count = string->count;
-    data->data = string->characters;
-    string->characters.retain();
+    if (string->offset == 0 && !string->isSmall()) {
+        data->data = string->characters;
+        string->characters.retain();
+    }
+    else {
+        data->data = runtime::allocate<runtime::Byte>(string->count);
+        std::memcpy(data->data.get(), string->bytes(), string->count);
+    }
     return data;
 }
 
 extern "C" void sStringCodepoints(String *string, runtime::Callable<void, runtime::Integer, runtime::Integer> cb) {
     for (size_t off = 0; off < string->count;) {
         utf8proc_int32_t codepoint;
-        auto state = utf8proc_iterate(reinterpret_cast<utf8proc_uint8_t *>(string->characters.get()) + off,
+        auto state = utf8proc_iterate(reinterpret_cast<utf8proc_uint8_t *>(string->bytes()) + off,
                                       string->count, &codepoint);
         if (state < 0) break;
         cb(codepoint, off);
@@ -146,259 +449,191 @@ extern "C" void sStringCodepoints(String *string, runtime::Callable<void, runtim
     }
 }
 
-extern "C" s::String* sStringTrim(String *string) {
-    size_t begin = 0;
+/// Whether @c codepoint is removed by 🔧. Of all ASCII characters only space and form feed qualify.
+static bool isTrimmedWhitespace(utf8proc_int32_t codepoint) {
+    if (codepoint < 0x80) {
+        return codepoint == ' ' || codepoint == '\f';
+    }
+    return utf8proc_get_property(codepoint)->bidi_class == UTF8PROC_BIDI_CLASS_WS;
+}
 
-    for (; begin < string->count;) {
-        utf8proc_int32_t codepoint;
-        auto state = utf8proc_iterate(reinterpret_cast<utf8proc_uint8_t *>(string->characters.get()) + begin,
-                                      string->count, &codepoint);
-        if (state < 0) break;
-        if (utf8proc_get_property(codepoint)->bidi_class != UTF8PROC_BIDI_CLASS_WS) break;
-        begin += state;
+extern "C" s::String* sStringTrim(String *string) {
+    auto bytes = reinterpret_cast<utf8proc_uint8_t *>(string->bytes());
+    runtime::Integer begin = 0, end = string->count;
+
+    while (begin < end) {
+        utf8proc_int32_t codepoint = bytes[begin];
+        auto length = codepoint < 0x80 ? 1 : utf8proc_iterate(bytes + begin, end - begin, &codepoint);
+        if (length < 0 || !isTrimmedWhitespace(codepoint)) break;
+        begin += length;
     }
 
-    size_t end = begin - 1;
-    for (size_t i = begin; i < string->count;) {
-        utf8proc_int32_t codepoint;
-        auto state = utf8proc_iterate(reinterpret_cast<utf8proc_uint8_t *>(string->characters.get()) + i,
-                                      string->count, &codepoint);
-        if (state < 0) break;
-        if (utf8proc_get_property(codepoint)->bidi_class != UTF8PROC_BIDI_CLASS_WS) {
-            end = i;
+    while (end > begin) {
+        auto start = end - 1;
+        while (start > begin && (bytes[start] & 0xC0) == 0x80) {
+            start--;
         }
-        i += state;
+        utf8proc_int32_t codepoint = bytes[start];
+        auto length = codepoint < 0x80 ? 1 : utf8proc_iterate(bytes + start, end - start, &codepoint);
+        if (length < 0 || !isTrimmedWhitespace(codepoint)) break;
+        end = start;
     }
 
-    auto newString = String::init();
-    newString->count = end - begin + 1;
-    newString->characters = runtime::allocate<char>(string->count);
-    std::memcpy(newString->characters.get(), string->characters.get() + begin, newString->count);
-    return newString;
+    return String::slice(string, begin, end - begin);
 }
 
 extern "C" void sStringGraphemes(String *string, runtime::Callable<void, s::String*> cb) {
-    auto bytes = reinterpret_cast<utf8proc_uint8_t *>(string->characters.get());
-    utf8proc_int32_t state = 0;
-    utf8proc_int32_t prev;
-
-    if (string->count == 0) {
-        return;
+    GraphemeCursor cursor(string, 0, 0);
+    while (!cursor.atEnd()) {
+        auto begin = cursor.offset();
+        cursor.advance();
+        auto grapheme = String::slice(string, begin, cursor.offset() - begin);
+        cb(grapheme);
+        grapheme->release();
     }
+}
 
-    size_t lastCut = 0;
-    size_t off = utf8proc_iterate(bytes, string->count, &prev);
-
-    while (off < string->count) {
-        utf8proc_int32_t cp;
-        auto c = utf8proc_iterate(bytes + off, string->count, &cp);
-
-        if (utf8proc_grapheme_break_stateful(prev, cp, &state)) {
-            auto newString = String::init();
-            newString->count = off - lastCut;
-            newString->characters = runtime::allocate<char>(newString->count);
-            std::memcpy(newString->characters.get(), string->characters.get() + lastCut, newString->count);
-            lastCut = off;
-            cb(newString);
-            newString->release();
-        }
-        prev = cp;
-        off += c;
+extern "C" runtime::Integer sStringGraphemeCount(String *string) {
+    if (auto index = string->loadGraphemeIndex()) {
+        return index->count();
     }
-
-    auto newString = String::init();
-    newString->count = off - lastCut;
-    newString->characters = runtime::allocate<char>(newString->count);
-    std::memcpy(newString->characters.get(), string->characters.get() + lastCut, newString->count);
-    lastCut = off;
-    cb(newString);
-    newString->release();
+    GraphemeCursor cursor(string, 0, 0);
+    return cursor.advance(string->count);
 }
 
 extern "C" s::String* sStringGraphemeSubstring(String *string, runtime::Integer from, runtime::Integer length) {
-    auto bytes = reinterpret_cast<utf8proc_uint8_t *>(string->characters.get());
-    utf8proc_int32_t state = 0;
-    utf8proc_int32_t prev, cp;
-    size_t beginCut = 0, off = utf8proc_iterate(bytes, string->count, &prev);
-
-    if (length == 0) {
-        auto newString = String::init();
-        newString->count = 0;
-        newString->characters = runtime::allocate<char>(0);
-        return newString;
-    }
-
-    while (off < string->count && from > 0) {
-        auto c = utf8proc_iterate(bytes + off, string->count, &cp);
-
-        if (utf8proc_grapheme_break_stateful(prev, cp, &state) && --from == 0) {
-            beginCut = off;
-            prev = cp;
-            off += c;
-            break;
-        }
-        prev = cp;
-        off += c;
-    }
-    while (off < string->count) {
-        auto c = utf8proc_iterate(bytes + off, string->count, &cp);
-
-        if (utf8proc_grapheme_break_stateful(prev, cp, &state) && --length == 0) {
-            break;
-        }
-        prev = cp;
-        off += c;
-    }
-
-    auto newString = String::init();
-    newString->count = off - beginCut;
-    newString->characters = runtime::allocate<char>(newString->count);
-    std::memcpy(newString->characters.get(), string->characters.get() + beginCut, newString->count);
-    return newString;
+    auto cursor = seekGrapheme(string, from);
+    auto begin = cursor.offset();
+    cursor.advance(length);
+    return String::slice(string, begin, cursor.offset() - begin);
 }
 
-runtime::SimpleOptional<runtime::Integer> sStringToIntLength(const char *characters,
-                                                             runtime::Integer length, runtime::Integer base) {
-    if (length == 0) {
-        return runtime::NoValue;
-    }
-    runtime::Integer x = 0;
-    for (decltype(length) i = 0; i < length; i++) {
-        if (i == 0 && (characters[i] == '-' || characters[i] == '+')) {
-            if (length < 2) {
-                return runtime::NoValue;
-            }
-            continue;
-        }
+extern "C" void sStringBuilderWriteInteger(s::StringBuilder *builder, runtime::Integer n, runtime::Integer base) {
+    s::formatInteger(n, base, builder->data.get() + builder->count);
+    builder->count += s::formattedIntegerLength(n, base);
+}
 
-        auto b = base;
-        if ('0' <= characters[i] && characters[i] <= '9') {
-            b = characters[i] - '0';
-        }
-        else if ('A' <= characters[i] && characters[i] <= 'Z') {
-            b = characters[i] - 'A' + 10;
-        }
-        else if ('a' <= characters[i] && characters[i] <= 'z') {
-            b = characters[i] - 'a' + 10;
-        }
+extern "C" runtime::Integer sStringBuilderRealLength(s::StringBuilder *builder, runtime::Real real,
+                                                    runtime::Integer precision) {
+    return s::formattedRealLength(real, precision);
+}
 
-        if (b >= base) {
-            return runtime::NoValue;
-        }
+extern "C" void sStringBuilderWriteReal(s::StringBuilder *builder, runtime::Real real, runtime::Integer precision) {
+    s::formatReal(real, precision, builder->data.get() + builder->count);
+    builder->count += s::formattedRealLength(real, precision);
+}
 
-        x *= base;
-        x += b;
-    }
+extern "C" void sStringBuilderWriteCodepoint(s::StringBuilder *builder, runtime::Integer codepoint) {
+    builder->count += utf8proc_encode_char(static_cast<utf8proc_int32_t>(codepoint),
+                                           reinterpret_cast<utf8proc_uint8_t *>(builder->data.get() + builder->count));
+}
 
-    if (characters[0] == '-') {
-        x *= -1;
-    }
-    return x;
+extern "C" void sStringDestruct(String *string) {
+    delete string->graphemeIndex.load(std::memory_order_relaxed);
 }
 
 extern "C" runtime::SimpleOptional<runtime::Integer> sStringToInt(String *string, runtime::Integer base) {
-    return sStringToIntLength(string->characters.get(), string->count, base);
+    return s::parseInteger(string->bytes(), string->count, base);
 }
 
 extern "C" runtime::SimpleOptional<runtime::Real> sStringToReal(String *string) {
-    if (string->count == 0) {
-        return runtime::NoValue;
-    }
+    auto characters = string->bytes();
+    auto length = string->count;
 
-    runtime::Real d = 0.0;
-    bool sign = true;
-    bool foundSeparator = false;
-    bool foundDigit = false;
-    size_t decimalPlace = 0;
-    decltype(string->count) i = 0;
+    // rapidjson ignores digits beyond this limit as well.
+    constexpr size_t kMaxDigits = 780;
+    constexpr int kMaxSignificandDigits = 19;
 
-    if (string->characters[0] == '-') {
-        sign = false;
-        i++;
-    }
-    else if (string->characters[0] == '+') {
+    runtime::Integer i = 0;
+    bool negative = false;
+    if (i < length && (characters[i] == '-' || characters[i] == '+')) {
+        negative = characters[i] == '-';
         i++;
     }
 
-    for (; i < string->count; i++) {
-        if (string->characters[i] == '.') {
+    char decimals[kMaxDigits];
+    size_t count = 0, decimalPosition = 0, leadingZeros = 0, consumed = 0;
+    uint64_t significand = 0;
+    int significandDigits = 0;
+    bool foundSeparator = false, foundDigit = false;
+    for (; i < length && characters[i] != 'e' && characters[i] != 'E'; i++) {
+        auto c = characters[i];
+        if (c == '.') {
             if (foundSeparator) {
                 return runtime::NoValue;
             }
             foundSeparator = true;
             continue;
         }
-        if (string->characters[i] == 'e' || string->characters[i] == 'E') {
-            auto exponent = sStringToIntLength(string->characters.get() + i + 1, string->count - i - 1, 10);
-            if (exponent == runtime::NoValue) {
-                return runtime::NoValue;
-            }
-            d *= std::pow(10, *exponent);
-            break;
+        if (c < '0' || '9' < c) {
+            return runtime::NoValue;
         }
-        if ('0' <= string->characters[i] && string->characters[i] <= '9') {
-            d *= 10;
-            d += string->characters[i] - '0';
-            if (foundSeparator) {
-                decimalPlace++;
-            }
-            foundDigit = true;
+
+        foundDigit = true;
+        if (!foundSeparator) {
+            decimalPosition++;
         }
-        else {
-            return runtime::NoValue;
+        if (count < kMaxDigits) {
+            decimals[count++] = c;
+        }
+        if (significandDigits == 0 && c == '0') {
+            leadingZeros++;
+        }
+        else if (significandDigits < kMaxSignificandDigits) {
+            significand = significand * 10 + (c - '0');
+            significandDigits++;
+            consumed = leadingZeros + significandDigits;
         }
     }
-
     if (!foundDigit) {
         return runtime::NoValue;
     }
 
-    d /= std::pow(10, decimalPlace);
-
-    if (!sign) {
-        d *= -1;
+    int exponent = 0;
+    if (i++ < length) {
+        bool negativeExponent = false;
+        if (i < length && (characters[i] == '-' || characters[i] == '+')) {
+            negativeExponent = characters[i] == '-';
+            i++;
+        }
+        if (i == length) {
+            return runtime::NoValue;
+        }
+        // Exponents beyond this bound result in zero or infinity anyway and must not overflow.
+        for (; i < length; i++) {
+            if (characters[i] < '0' || '9' < characters[i]) {
+                return runtime::NoValue;
+            }
+            exponent = std::min(exponent * 10 + (characters[i] - '0'), 100000);
+        }
+        if (negativeExponent) {
+            exponent = -exponent;
+        }
     }
-    return d;
-}
-
-extern "C" runtime::Integer sStringHash(String *string) {
-    auto len = string->count;
-    const unsigned int m = 0x5bd1e995;
-    const int r = 24;
 
-    unsigned int h = runtime::internal::seed ^ len;
-
-    const unsigned char * data = reinterpret_cast<const unsigned char *>(string->characters.get());
-
-    while(len >= 4) {
-        unsigned int k;
-
-        k  = data[0];
-        k |= data[1] << 8;
-        k |= data[2] << 16;
-        k |= data[3] << 24;
-
-        k *= m;
-        k ^= k >> r;
-        k *= m;
-
-        h *= m;
-        h ^= k;
-
-        data += 4;
-        len -= 4;
+    double value;
+    auto magnitude = static_cast<int>(decimalPosition) - static_cast<int>(leadingZeros) + exponent;
+    if (significandDigits == 0 || magnitude < -330) {
+        value = 0;
     }
-
-    switch(len) {
-        case 3: h ^= data[2] << 16;
-        case 2: h ^= data[1] << 8;
-        case 1: h ^= data[0];
-                h *= m;
+    else if (magnitude > 310) {
+        value = HUGE_VAL;
+    }
+    else {
+        auto p = static_cast<int>(decimalPosition) - static_cast<int>(consumed) + exponent;
+        value = rapidjson::internal::StrtodFullPrecision(static_cast<double>(significand), p, decimals, count,
+                                                         decimalPosition, exponent);
+        if (std::isnan(value)) {
+            value = HUGE_VAL;  // StrtodFullPrecision does not handle values just above the largest double
+        }
     }
+    return negative ? -value : value;
+}
 
-    h ^= h >> 13;
-    h *= m;
-    h ^= h >> 15;
+extern "C" runtime::Integer sStringHash(String *string) {
+    return string->loadHash();
+}
 
-    return h;
+extern "C" runtime::Boolean sStringEqual(String *string, String *other) {
+    return string->equals(other);
 }
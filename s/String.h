@@ -9,14 +9,20 @@
 #ifndef String_hpp
 #define String_hpp
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include "../runtime/Runtime.h"
 
 namespace s {
 
+class GraphemeIndex;
+
 class String : public runtime::Object<String>  {
 public:
+    /// The number of bytes a value may have to be stored in the string object itself.
+    static constexpr runtime::Integer kSmallCapacity = 16;
+
     String(const char *string);
     /// Creates a string without a value.
     /// @warning A string object created with this constructor is not ready for use!
@@ -25,16 +31,83 @@ public:
     /// This method can be used to make a newly constructed string represent the value of the provided string.
     /// @warning Do not use this method to modify an existing string, i.e. one that has a value already.
     void store(const char *cstring);
+    /// Like store() but copies @c count bytes from @c bytes.
+    void store(const char *bytes, runtime::Integer count);
+    /// Makes a newly constructed string represent @c count bytes, which the caller must write to the returned buffer.
+    /// Values of up to kSmallCapacity bytes are stored in the string object itself.
+    /// @warning Do not use this method to modify an existing string, i.e. one that has a value already.
+    char* allocate(runtime::Integer count);
+
+    /// Creates a string representing @c count bytes of the value of @c parent beginning at byte @c from.
+    /// The new string shares the buffer of @c parent unless the bytes fit into the new string object itself.
+    static String* slice(String *parent, runtime::Integer from, runtime::Integer count);
+
+    /// Whether the value is stored in this object. The value must be copied if it is to outlive this object.
+    bool isSmall() const { return characters.get() == smallBytes; }
+
+    /// Returns a pointer to the first UTF-8 byte of the value of this string.
+    char* bytes() { return characters.get() + offset; }
+
+    /// Returns the grapheme index of this string and builds it on first use.
+    /// @returns The index or @c nullptr if the string is too short to benefit from an index or cannot store one.
+    GraphemeIndex* loadGraphemeIndex();
+
+    /// Returns the hash of the value of this string and stores it in @c hash on first use.
+    runtime::Integer loadHash();
+    /// Whether this string is the representative of its value in the intern table. See intern().
+    bool isInterned() const { return hash.load(std::memory_order_relaxed) < 0; }
 
     runtime::MemoryPointer<char> characters;
     runtime::Integer count;
+    /// The offset of the value of this string into @c characters. Only slices have a non-zero offset.
+    runtime::Integer offset = 0;
+    /// Lazily built by loadGraphemeIndex() and owned by this string. Strings are immutable so the index never needs
+    /// to be invalidated.
+    std::atomic<GraphemeIndex*> graphemeIndex{nullptr};
+    /// The hash of the value of this string or 0 if it has not been computed yet. Hashes are never negative, the
+    /// sign bit marks interned strings instead.
+    std::atomic<runtime::Integer> hash{0};
+    /// Precedes @c smallBytes, which @c characters points to if isSmall(), as the control block header of a 🧠.
+    /// It is set to the ignore block so that retaining and releasing @c characters has no effect.
+    runtime::internal::ControlBlock *smallBlock = nullptr;
+    char smallBytes[kSmallCapacity] = {};
 
     std::string stdString();
     int compare(String *other);
+    bool equals(String *other);
 };
 
+/// Returns the string in the intern table whose value equals the value of @c string. If there is none, @c string
+/// itself or, if @c string cannot be shared, a copy of it is added. The table keeps its strings alive forever.
+/// @note The returned string is not retained for the caller.
+String* intern(String *string);
+
+/// The string builder 🔠.
+class StringBuilder : public runtime::Object<StringBuilder> {
+public:
+    runtime::MemoryPointer<char> data;
+    runtime::Integer count;
+    runtime::Integer size;
+};
+
+/// Returns the number of bytes formatInteger() writes for @c n in @c base.
+runtime::Integer formattedIntegerLength(runtime::Integer n, runtime::Integer base);
+/// Writes the digits of @c n in @c base to the formattedIntegerLength() bytes at @c buffer.
+void formatInteger(runtime::Integer n, runtime::Integer base, char *buffer);
+/// Parses the @c length bytes at @c characters as an integer in @c base, optionally preceded by a sign.
+/// @returns The integer or no value if a character is not a digit in @c base or the integer does not fit into
+/// runtime::Integer.
+runtime::SimpleOptional<runtime::Integer> parseInteger(const char *characters, runtime::Integer length,
+                                                       runtime::Integer base);
+/// Returns the number of bytes formatReal() writes for @c real with @c precision decimal places.
+runtime::Integer formattedRealLength(runtime::Real real, runtime::Integer precision);
+/// Writes @c real with @c precision decimal places to the formattedRealLength() bytes at @c buffer. Further decimal
+/// places are truncated.
+void formatReal(runtime::Real real, runtime::Integer precision, char *buffer);
+
 }  // namespace s
 
 SET_INFO_FOR(s::String, s, 1f521)
+SET_INFO_FOR(s::StringBuilder, s, 1f520)
 
 #endif /* String_hpp */
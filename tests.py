@@ -81,6 +81,9 @@ compilation_tests = [
     "includer",
     "threads",
     "inferListLiteralFromExpec",
+    "literalCopyOnWrite",
+    "forInKnownTypes",
+    "tailCall",
     "sequenceTypeNames",
     "typeValues",
     "rcOrder",
@@ -108,8 +111,14 @@ library_tests = [
     "dataTest",
     "systemTest",
     "listTest",
+    "vectorTest",
+    "dequeTest",
+    "lazyTest",
+    "simdTest",
     "enumerator",
     "dictionaryTest",
+    "setTest",
+    "sortedTest",
     # "jsonTest",
     "fileTest"
 ]